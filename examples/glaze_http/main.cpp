@@ -1,5 +1,5 @@
 #include <asio/error.hpp>            // asio::error::operation_aborted
-#include <chrono>                    // std::chrono::{minutes, steady_clock, time_point}
+#include <chrono>                    // std::chrono::{hours, minutes}
 #include <csignal>                   // SIGINT, SIGTERM, SIG_ERR, std::signal
 #include <cstdlib>                   // EXIT_FAILURE, EXIT_SUCCESS
 #include <fstream>                   // std::ifstream
@@ -17,8 +17,6 @@
 #include <glaze/core/meta.hpp>       // glz::{meta, detail::Object}
 #include <glaze/net/http_server.hpp> // glz::http_server
 #include <matchit.hpp>               // matchit::impl::Overload
-#include <mutex>                     // std::{mutex, unique_lock}
-#include <optional>                  // std::optional
 #include <utility>                   // std::move
 
 #ifndef fn
@@ -45,12 +43,6 @@ namespace {
 
   struct State {
 #if DRAC_ENABLE_WEATHER
-    mutable struct WeatherCache {
-      std::optional<Result<Report>>         report;
-      std::chrono::steady_clock::time_point lastChecked;
-      mutable std::mutex                    mtx;
-    } weatherCache;
-
     mutable UniquePointer<IWeatherService> weatherService;
 #endif
   };
@@ -128,6 +120,15 @@ fn main() -> i32 {
 
     if (!GetState().weatherService)
       error_log("Error: Failed to initialize WeatherService.");
+
+    // Serve the last report while a fresh one is fetched in the background, so
+    // a request never waits on the weather API once the first report is in.
+    GetCacheManager()->setKeyPolicy("weather_", {
+      .location             = draconis::utils::cache::CacheLocation::Persistent,
+      .ttl                  = std::chrono::minutes(10),
+      .staleWhileRevalidate = std::chrono::hours(24),
+      .refreshAhead         = std::chrono::minutes(1),
+    });
   }
 
   server.on_error([](const std::error_code errc, const std::source_location& loc) {
@@ -219,41 +220,12 @@ fn main() -> i32 {
         addProperty("Now Playing", GetNowPlaying());
 
       if constexpr (DRAC_ENABLE_WEATHER) {
-        using namespace std::chrono;
-
-        Result<Report> weatherResultToAdd;
-
-        std::unique_lock<std::mutex> lock(GetState().weatherCache.mtx);
-
-        time_point now = steady_clock::now();
-
-        bool needsFetch = true;
-
-        if (GetState().weatherCache.report.has_value() && now - GetState().weatherCache.lastChecked < minutes(10)) {
-          info_log("Using cached weather data.");
-          weatherResultToAdd = *GetState().weatherCache.report;
-          needsFetch         = false;
-        }
-
-        if (needsFetch) {
-          info_log("Fetching new weather data...");
-          if (GetState().weatherService) {
-            Result<Report> fetchedReport        = GetState().weatherService->getWeatherInfo();
-            GetState().weatherCache.report      = fetchedReport;
-            GetState().weatherCache.lastChecked = now;
-            weatherResultToAdd                  = fetchedReport;
-          } else {
-            error_log("Weather service is not initialized. Cannot fetch new data.");
-            Result<Report> errorReport          = Err({ ApiUnavailable, "Weather service not initialized" });
-            GetState().weatherCache.report      = errorReport;
-            GetState().weatherCache.lastChecked = now;
-            weatherResultToAdd                  = errorReport;
-          }
+        if (GetState().weatherService)
+          addProperty("Weather", GetState().weatherService->getWeatherInfo());
+        else {
+          error_log("Weather service is not initialized. Cannot fetch new data.");
+          addProperty("Weather", Result<Report>(Err({ ApiUnavailable, "Weather service not initialized" })));
         }
-
-        lock.unlock();
-
-        addProperty("Weather", weatherResultToAdd);
       }
     }
 
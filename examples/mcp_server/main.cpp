@@ -244,18 +244,6 @@ namespace glz {
     // clang-format on
   };
 
-  template <>
-  struct meta<MediaInfo> {
-    using T = MediaInfo;
-
-    // clang-format off
-    static constexpr detail::Object value = object(
-      "title",  &T::title,
-      "artist", &T::artist
-    );
-    // clang-format on
-  };
-
   template <>
   struct meta<ResourceUsage> {
     using T = ResourceUsage;
@@ -383,7 +371,8 @@ namespace {
         location                           = locationInfo.locationName;
       }
 
-      UniquePointer<IWeatherService> weatherService = CreateWeatherService(
+      // Shared so the fetcher below can keep it alive for a background refresh.
+      SharedPointer<IWeatherService> weatherService = CreateWeatherService(
         Provider::MetNo, *coordsResult, UnitSystem::Imperial
       );
 
@@ -392,7 +381,7 @@ namespace {
 
       String         weatherCacheKey = "weather_" + location;
       Result<Report> weatherResult   = GetCacheManager().getOrSet<Report>(
-        weatherCacheKey, [&]() -> Result<Report> { return weatherService->getWeatherInfo(); }
+        weatherCacheKey, [weatherService]() -> Result<Report> { return weatherService->getWeatherInfo(); }
       );
 
       if (!weatherResult)
@@ -581,18 +570,18 @@ namespace {
     if constexpr (DRAC_ENABLE_WEATHER) {
       if (auto locIter = params.find("location"); locIter != params.end() && !locIter->second.empty()) {
         if (Result coords = Geocode(locIter->second); coords)
-          if (UniquePointer<IWeatherService> weatherService = CreateWeatherService(Provider::MetNo, *coords, UnitSystem::Imperial)) {
+          if (SharedPointer<IWeatherService> weatherService = CreateWeatherService(Provider::MetNo, *coords, UnitSystem::Imperial)) {
             String weatherCacheKey = "weather_" + locIter->second;
-            if (Result weather = cacheManager.getOrSet<Report>(weatherCacheKey, [&]() -> Result<Report> { return weatherService->getWeatherInfo(); }); weather)
+            if (Result weather = cacheManager.getOrSet<Report>(weatherCacheKey, [weatherService]() -> Result<Report> { return weatherService->getWeatherInfo(); }); weather)
               info.weather = *weather;
           }
       } else if (Result locationInfo = GetCurrentLocationInfoFromIP(); locationInfo)
-        if (UniquePointer<IWeatherService> weatherService = CreateWeatherService(Provider::MetNo, locationInfo->coords, UnitSystem::Imperial)) {
+        if (SharedPointer<IWeatherService> weatherService = CreateWeatherService(Provider::MetNo, locationInfo->coords, UnitSystem::Imperial)) {
           String weatherCacheKey = "weather_" + locationInfo->locationName;
           if (
             Result weather = cacheManager.getOrSet<Report>(
               weatherCacheKey,
-              [&]() -> Result<Report> {
+              [weatherService]() -> Result<Report> {
                 return weatherService->getWeatherInfo();
               }
             );
@@ -637,6 +626,10 @@ namespace {
   fn CacheClearHandler() -> ToolResponse {
     return { makeSuccessResult(std::format("Removed {} files.", GetCacheManager().invalidateAll(false))) };
   }
+
+  fn CacheStatsHandler() -> ToolResponse {
+    return { makeSuccessResult(GetCacheManager().stats()) };
+  }
 } // namespace
 
 class DracStdioServer {
@@ -862,11 +855,24 @@ class DracStdioServer {
 fn main() -> i32 {
   DracStdioServer server("Draconis++ MCP Server", DRAC_VERSION);
 
+  // Tool calls should never wait on an expired weather report or package
+  // count; serve the old value and refresh it in the background instead.
+  const draconis::utils::cache::CachePolicy serveStale {
+    .location             = draconis::utils::cache::CacheLocation::Persistent,
+    .ttl                  = std::chrono::days(1),
+    .staleWhileRevalidate = std::chrono::days(7),
+    .refreshAhead         = std::chrono::hours(1),
+  };
+
+  GetCacheManager().setKeyPolicy("weather_", serveStale);
+  GetCacheManager().setKeyPolicy("pkg_count_", serveStale);
+
   server.setCapabilities({
     { "tools", { { "listChanged", true } } }
   });
 
   Tool cacheClearTool("cache_clear", "Clear all cached data");
+  Tool cacheStatsTool("cache_stats", "Get per-key cache statistics (hits, misses, fetch latency, bytes read/written) since the server started");
   Tool systemInfoTool("system_info", "Get system information (OS, kernel, host, shell, desktop environment, window manager)");
   Tool hardwareInfoTool("hardware_info", "Get hardware information (CPU, GPU, memory, disk, battery)");
   Tool networkInfoTool("network_info", "Get network interface information");
@@ -893,6 +899,7 @@ fn main() -> i32 {
   );
 
   server.registerTool(cacheClearTool, CacheClearHandler);
+  server.registerTool(cacheStatsTool, CacheStatsHandler);
   server.registerTool(systemInfoTool, SystemInfoHandler);
   server.registerTool(hardwareInfoTool, HardwareInfoHandler);
   server.registerTool(weatherTool, WeatherHandler);
@@ -1,5 +1,5 @@
 #include <algorithm> // std::{clamp, ranges::find_if}
-#include <chrono>    // std::chrono::{duration_cast, seconds, steady_clock, time_point}
+#include <chrono>    // std::chrono::{days, duration_cast, hours, seconds, steady_clock, time_point}
 
 #include <Drac++/Core/System.hpp>
 #include <Drac++/Services/Packages.hpp>
@@ -408,6 +408,15 @@ fn main() -> i32 {
 
   draconis::utils::cache::CacheManager cacheManager;
 
+  // Never stall a frame on an expired package count; serve it and refresh it
+  // in the background instead.
+  cacheManager.setKeyPolicy("pkg_count_", {
+    .location             = draconis::utils::cache::CacheLocation::Persistent,
+    .ttl                  = std::chrono::days(1),
+    .staleWhileRevalidate = std::chrono::days(7),
+    .refreshAhead         = std::chrono::hours(1),
+  });
+
   while (!glfwWindowShouldClose(window)) {
     glfwPollEvents();
 
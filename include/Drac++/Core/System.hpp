@@ -1,6 +1,11 @@
 /**
  * @file System.hpp
  * @brief Defines the os::System class, a cross-platform interface for querying system information.
+ *
+ * Readouts that can block for a while (DBus round trips, package database
+ * queries, directory scans) honor the calling thread's CancellationScope and
+ * return a Cancelled or Timeout error once it is stopped or out of time.
+ *
  * @author pupbrained/Draconis
  * @version DRACONISPLUSPLUS_VERSION
  */
@@ -8,7 +13,9 @@
 #pragma once
 
 #include "../Utils/CacheManager.hpp"
+#include "../Utils/Cancellation.hpp"
 #include "../Utils/DataTypes.hpp"
+#include "../Utils/Task.hpp"
 #include "../Utils/Types.hpp"
 
 namespace draconis::core::system {
@@ -26,11 +33,14 @@ namespace draconis::core::system {
     using utils::types::ResourceUsage;
     using utils::types::Result;
     using utils::types::String;
+    using utils::types::u32;
     using utils::types::u64;
     using utils::types::usize;
     using utils::types::Vec;
 
     using utils::cache::CacheManager;
+    using utils::threading::Spawn;
+    using utils::threading::Task;
   } // namespace
 
   /**
@@ -661,6 +671,101 @@ namespace draconis::core::system {
    */
   fn GetBatteryInfo(CacheManager& cache) -> Result<Battery>;
 
+  /**
+   * @name Asynchronous readouts
+   * @brief Start the matching readout on the shared ThreadPool and return a Task for its result.
+   *
+   * @details Tasks started together run concurrently, and can be waited on,
+   * `co_await`ed or cancelled individually. @p cache is used from a pool
+   * thread, so it must outlive the task (or the task must be cancelled
+   * and no longer running before it goes away).
+   *
+   * @code{.cpp}
+   * Task<String>        cpu = draconis::core::system::GetCPUModelAsync(cache);
+   * Task<ResourceUsage> mem = draconis::core::system::GetMemInfoAsync(cache);
+   *
+   * if (!mem.waitFor(std::chrono::milliseconds(100)))
+   *   mem.cancel(); // mem.get() now returns a Cancelled error.
+   *
+   * Result<String> cpuModel = cpu.get();
+   * @endcode
+   * @{
+   */
+  inline fn GetMemInfoAsync(CacheManager& cache) -> Task<ResourceUsage> {
+    return Spawn([&cache] { return GetMemInfo(cache); });
+  }
+
+#if DRAC_ENABLE_NOWPLAYING
+  inline fn GetNowPlayingAsync() -> Task<MediaInfo> {
+    return Spawn([] { return GetNowPlaying(); });
+  }
+#endif
+
+  inline fn GetOperatingSystemAsync(CacheManager& cache) -> Task<OSInfo> {
+    return Spawn([&cache] { return GetOperatingSystem(cache); });
+  }
+
+  inline fn GetDesktopEnvironmentAsync(CacheManager& cache) -> Task<String> {
+    return Spawn([&cache] { return GetDesktopEnvironment(cache); });
+  }
+
+  inline fn GetWindowManagerAsync(CacheManager& cache) -> Task<String> {
+    return Spawn([&cache] { return GetWindowManager(cache); });
+  }
+
+  inline fn GetShellAsync(CacheManager& cache) -> Task<String> {
+    return Spawn([&cache] { return GetShell(cache); });
+  }
+
+  inline fn GetHostAsync(CacheManager& cache) -> Task<String> {
+    return Spawn([&cache] { return GetHost(cache); });
+  }
+
+  inline fn GetCPUModelAsync(CacheManager& cache) -> Task<String> {
+    return Spawn([&cache] { return GetCPUModel(cache); });
+  }
+
+  inline fn GetCPUCoresAsync(CacheManager& cache) -> Task<CPUCores> {
+    return Spawn([&cache] { return GetCPUCores(cache); });
+  }
+
+  inline fn GetGPUModelAsync(CacheManager& cache) -> Task<String> {
+    return Spawn([&cache] { return GetGPUModel(cache); });
+  }
+
+  inline fn GetKernelVersionAsync(CacheManager& cache) -> Task<String> {
+    return Spawn([&cache] { return GetKernelVersion(cache); });
+  }
+
+  inline fn GetDiskUsageAsync(CacheManager& cache) -> Task<ResourceUsage> {
+    return Spawn([&cache] { return GetDiskUsage(cache); });
+  }
+
+  inline fn GetUptimeAsync() -> Task<std::chrono::seconds> {
+    return Spawn([] { return GetUptime(); });
+  }
+
+  inline fn GetOutputsAsync(CacheManager& cache) -> Task<Vec<DisplayInfo>> {
+    return Spawn([&cache] { return GetOutputs(cache); });
+  }
+
+  inline fn GetPrimaryOutputAsync(CacheManager& cache) -> Task<DisplayInfo> {
+    return Spawn([&cache] { return GetPrimaryOutput(cache); });
+  }
+
+  inline fn GetNetworkInterfacesAsync(CacheManager& cache) -> Task<Vec<NetworkInterface>> {
+    return Spawn([&cache] { return GetNetworkInterfaces(cache); });
+  }
+
+  inline fn GetPrimaryNetworkInterfaceAsync(CacheManager& cache) -> Task<NetworkInterface> {
+    return Spawn([&cache] { return GetPrimaryNetworkInterface(cache); });
+  }
+
+  inline fn GetBatteryInfoAsync(CacheManager& cache) -> Task<Battery> {
+    return Spawn([&cache] { return GetBatteryInfo(cache); });
+  }
+  /// @}
+
 #ifdef __linux__
   namespace linux {
     /**
@@ -672,4 +777,100 @@ namespace draconis::core::system {
     fn GetDistroID(CacheManager& cache) -> Result<String>;
   } // namespace linux
 #endif
+
+  /**
+   * @brief Selects readouts for CollectReadouts().
+   */
+  enum class Readout : u32 {
+    None                    = 0,
+    MemInfo                 = 1U << 0U,
+    Uptime                  = 1U << 1U,
+    OperatingSystem         = 1U << 2U,
+    DesktopEnvironment      = 1U << 3U,
+    WindowManager           = 1U << 4U,
+    Shell                   = 1U << 5U,
+    Host                    = 1U << 6U,
+    CPUModel                = 1U << 7U,
+    CPUCores                = 1U << 8U,
+    GPUModel                = 1U << 9U,
+    KernelVersion           = 1U << 10U,
+    DiskUsage               = 1U << 11U,
+    Outputs                 = 1U << 12U,
+    PrimaryOutput           = 1U << 13U,
+    NetworkInterfaces       = 1U << 14U,
+    PrimaryNetworkInterface = 1U << 15U,
+    Battery                 = 1U << 16U,
+    NowPlaying              = 1U << 17U, ///< Ignored unless built with DRAC_ENABLE_NOWPLAYING.
+    DistroID                = 1U << 18U, ///< Linux only; ignored elsewhere.
+    All                     = (1U << 19U) - 1,
+  };
+
+  constexpr fn operator|(const Readout lhs, const Readout rhs)->Readout {
+    return static_cast<Readout>(static_cast<u32>(lhs) | static_cast<u32>(rhs));
+  }
+
+  constexpr fn operator|=(Readout& lhs, const Readout rhs)->Readout& {
+    return lhs = lhs | rhs;
+  }
+
+  /**
+   * @brief Checks whether @p readout is part of @p set.
+   */
+  constexpr fn HasReadout(const Readout set, const Readout readout) -> bool {
+    return (static_cast<u32>(set) & static_cast<u32>(readout)) != 0;
+  }
+
+  /**
+   * @brief Results of CollectReadouts(). Readouts that weren't requested are None.
+   */
+  struct Readouts {
+    Option<Result<ResourceUsage>>         memInfo;
+    Option<Result<std::chrono::seconds>>  uptime;
+    Option<Result<OSInfo>>                operatingSystem;
+    Option<Result<String>>                desktopEnvironment;
+    Option<Result<String>>                windowManager;
+    Option<Result<String>>                shell;
+    Option<Result<String>>                host;
+    Option<Result<String>>                cpuModel;
+    Option<Result<CPUCores>>              cpuCores;
+    Option<Result<String>>                gpuModel;
+    Option<Result<String>>                kernelVersion;
+    Option<Result<ResourceUsage>>         diskUsage;
+    Option<Result<Vec<DisplayInfo>>>      outputs;
+    Option<Result<DisplayInfo>>           primaryOutput;
+    Option<Result<Vec<NetworkInterface>>> networkInterfaces;
+    Option<Result<NetworkInterface>>      primaryNetworkInterface;
+    Option<Result<Battery>>               battery;
+#if DRAC_ENABLE_NOWPLAYING
+    Option<Result<MediaInfo>> nowPlaying;
+#endif
+#ifdef __linux__
+    Option<Result<String>> distroId;
+#endif
+  };
+
+  /**
+   * @brief Fetches several readouts at once, sharing the work they have in common.
+   * @param readouts The readouts to fetch.
+   * @return Every requested readout, exactly as the matching GetX() function would return it.
+   *
+   * @details Readouts that come from the same underlying source only query it
+   * once per call. On Linux, for example, memory and uptime share one
+   * `sysinfo` call, the OS and distro ID one parse of `/etc/os-release`, the
+   * window manager and outputs one X11/Wayland connection, and the two network
+   * readouts one set of rtnetlink dumps (links, addresses and routes, the
+   * primary interface falling back to the first one that is up when there's
+   * no default route). Everything else falls back to the regular per-readout
+   * function.
+   *
+   * @code{.cpp}
+   * using enum draconis::core::system::Readout;
+   *
+   * Readouts readouts = draconis::core::system::CollectReadouts(cache, MemInfo | Uptime | WindowManager | Outputs);
+   *
+   * if (*readouts.memInfo)
+   *   std::println("Used: {} bytes", (*readouts.memInfo)->usedBytes);
+   * @endcode
+   */
+  fn CollectReadouts(CacheManager& cache, Readout readouts) -> Readouts;
 } // namespace draconis::core::system
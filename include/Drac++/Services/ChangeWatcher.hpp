@@ -0,0 +1,124 @@
+/**
+ * @file ChangeWatcher.hpp
+ * @brief Drops cached readouts as soon as the system tells us they changed.
+ *
+ * Cached readouts otherwise stay stale until their TTL runs out, which makes
+ * long TTLs a trade against freshness. A ChangeWatcher runs one thread that
+ * listens to the kernel instead of polling:
+ *
+ * - rtnetlink link, address and route notifications invalidate the network
+ *   interface readouts,
+ * - drm uevents invalidate the GPU model, and power_supply uevents are
+ *   reported for the (uncached) battery readout,
+ * - inotify on /etc/os-release and the package manager databases invalidate
+ *   the OS and package count readouts.
+ *
+ * Only the affected CacheManager keys are invalidated, so an embedder can use
+ * CachePolicy::neverExpire() and still see changes within milliseconds.
+ *
+ * @code{.cpp}
+ * CacheManager cache;
+ *
+ * Result<UniquePointer<ChangeWatcher>> watcher = ChangeWatcher::start(cache, {
+ *   .onChange = [](const Change change) { if (change == Change::PowerSupply) redrawBattery(); },
+ * });
+ * @endcode
+ *
+ * @note Only available on Linux.
+ */
+
+#pragma once
+
+#ifdef __linux__
+
+  #include <chrono>
+  #include <filesystem>
+  #include <thread>
+
+  #include "../Utils/CacheManager.hpp"
+  #include "../Utils/Types.hpp"
+
+namespace draconis::services::watcher {
+  namespace {
+    namespace fs = std::filesystem;
+
+    using utils::cache::CacheManager;
+
+    using utils::types::Fn;
+    using utils::types::Pair;
+    using utils::types::Result;
+    using utils::types::String;
+    using utils::types::u8;
+    using utils::types::UniquePointer;
+    using utils::types::Unit;
+    using utils::types::Vec;
+  } // namespace
+
+  /**
+   * @brief What a batch of invalidations was triggered by.
+   */
+  enum class Change : u8 {
+    Network,         ///< A link, address or route was added, removed or changed.
+    Display,         ///< A DRM device (GPU or connector) was added, removed or changed.
+    PowerSupply,     ///< A battery or AC adapter changed state.
+    OperatingSystem, ///< os-release was replaced.
+    Packages,        ///< A package manager's database changed.
+    File,            ///< One of WatcherOptions::files changed.
+  };
+
+  struct WatcherOptions {
+    /**
+     * @brief Called on the watcher thread once the keys for @p change have been invalidated.
+     * @details Also the only way to hear about changes to readouts that aren't cached, like the battery.
+     */
+    Fn<Unit(Change)> onChange;
+
+    /**
+     * @brief How long to keep collecting events after the first one before invalidating.
+     * @details A package install touches its database many times; this folds them into one invalidation.
+     */
+    std::chrono::milliseconds coalesce = std::chrono::milliseconds(50);
+
+    /**
+     * @brief Extra files to watch, each with the cache keys to invalidate when it changes.
+     * @details The file's directory must exist; the file itself may come and go.
+     * Only the file's exact name counts, not other entries in its directory.
+     */
+    Vec<Pair<fs::path, Vec<String>>> files;
+  };
+
+  /**
+   * @brief Owns the watcher thread; destroying it stops the thread.
+   */
+  class ChangeWatcher {
+   public:
+    /**
+     * @brief Starts watching and invalidating keys of @p cache, which must outlive the watcher.
+     * @details Sources that can't be opened (uevents are often unavailable in
+     * containers, say) are skipped.
+     * @return The watcher, or an error if no source at all could be opened.
+     */
+    static fn start(CacheManager& cache, WatcherOptions options = {}) -> Result<UniquePointer<ChangeWatcher>>;
+
+    ~ChangeWatcher();
+
+    ChangeWatcher(const ChangeWatcher&)                = delete;
+    ChangeWatcher(ChangeWatcher&&)                     = delete;
+    fn operator=(const ChangeWatcher&)->ChangeWatcher& = delete;
+    fn operator=(ChangeWatcher&&)->ChangeWatcher&      = delete;
+
+   private:
+    struct Sources;
+
+    ChangeWatcher(CacheManager& cache, WatcherOptions options, UniquePointer<Sources> sources);
+
+    fn run() -> Unit;
+
+    CacheManager&          m_cache;
+    WatcherOptions         m_options;
+    UniquePointer<Sources> m_sources;
+    std::thread            m_thread;
+  };
+} // namespace draconis::services::watcher
+
+#endif // __linux__
@@ -0,0 +1,161 @@
+/**
+ * @file CpuSampler.hpp
+ * @brief Per-core and aggregate CPU utilization from repeated /proc/stat samples.
+ *
+ * Each call to CpuSampler::sample() reads the cpu lines of /proc/stat with a
+ * single pread() on a descriptor kept open between samples, scans the tick
+ * counters by hand, and turns the difference from the previous sample into
+ * busy, idle, iowait and steal fractions for the aggregate and every core.
+ *
+ * The last HISTORY_SIZE intervals are kept in a ring laid out structure-of-
+ * arrays: one contiguous block per metric, one row per sample, one column per
+ * CPU. Recording a sample writes four contiguous rows, and a metric's history
+ * for one CPU is a fixed-stride walk through a single block. Nothing is
+ * allocated per sample once the CPU count is known.
+ *
+ * @code{.cpp}
+ * Result<CpuSampler> cpu = CpuSampler::create();
+ *
+ * while (running) {
+ *   (void)cpu->sample();
+ *
+ *   if (Option<CpuLoad> load = cpu->aggregate())
+ *     draw(load->busy);
+ *
+ *   std::this_thread::sleep_for(100ms);
+ * }
+ * @endcode
+ *
+ * @note Only available on Linux. A sampler isn't thread-safe; use one per thread.
+ */
+
+#pragma once
+
+#ifdef __linux__
+
+  #include "../Utils/Types.hpp"
+
+namespace draconis::services::sampling {
+  namespace {
+    using utils::types::Array;
+    using utils::types::f32;
+    using utils::types::Option;
+    using utils::types::Result;
+    using utils::types::StringView;
+    using utils::types::u64;
+    using utils::types::u8;
+    using utils::types::UniquePointer;
+    using utils::types::Unit;
+    using utils::types::usize;
+    using utils::types::Vec;
+  } // namespace
+
+  /**
+   * @brief Where a CPU's time went over one interval, as fractions of that interval's ticks.
+   * @details busy + idle + iowait + steal is 1. Busy covers user, nice, system, irq and softirq time (guest time is already counted in user).
+   */
+  struct CpuLoad {
+    f32 busy   = 0;
+    f32 idle   = 0;
+    f32 iowait = 0;
+    f32 steal  = 0; ///< Time the hypervisor ran something else; nonzero only in VMs.
+  };
+
+  enum class CpuMetric : u8 {
+    Busy,
+    Idle,
+    IoWait,
+    Steal,
+  };
+
+  class CpuSampler {
+   public:
+    /// Intervals kept; at 10 Hz that covers 6.4 seconds.
+    static constexpr usize HISTORY_SIZE = 64;
+
+    /**
+     * @brief Opens /proc/stat.
+     */
+    static fn create() -> Result<CpuSampler>;
+
+    ~CpuSampler();
+
+    CpuSampler(const CpuSampler&)                = delete;
+    CpuSampler(CpuSampler&&) noexcept;
+    fn operator=(const CpuSampler&)->CpuSampler& = delete;
+    fn operator=(CpuSampler&&) noexcept -> CpuSampler&;
+
+    /**
+     * @brief Reads /proc/stat and records the interval since the previous sample.
+     * @details The first sample only sets the baseline.
+     */
+    fn sample() -> Result<>;
+
+    /**
+     * @brief Records the cpu lines of @p procStat, as sample() does with what it reads.
+     * @details Lines after the cpu lines are ignored, so the whole file can be passed.
+     * More CPUs than seen before (after hotplug, say) start the history over.
+     * @return A ParseError if there's no aggregate cpu line.
+     */
+    fn record(StringView procStat) -> Result<>;
+
+    /**
+     * @brief One more than the highest CPU number seen; offline CPUs in between count too.
+     */
+    [[nodiscard]] fn coreCount() const -> usize;
+
+    /**
+     * @brief How many intervals are recorded, up to HISTORY_SIZE.
+     */
+    [[nodiscard]] fn intervalCount() const -> usize;
+
+    /**
+     * @brief Load across all CPUs, @p age intervals before the latest one.
+     * @return None if fewer than @p age + 1 intervals are recorded.
+     */
+    [[nodiscard]] fn aggregate(usize age = 0) const -> Option<CpuLoad>;
+
+    /**
+     * @brief Load of CPU @p core, @p age intervals before the latest one.
+     * @return None if @p core doesn't exist, was offline then, or fewer than @p age + 1 intervals are recorded.
+     */
+    [[nodiscard]] fn core(usize core, usize age = 0) const -> Option<CpuLoad>;
+
+    /**
+     * @brief One metric over every recorded interval, oldest first.
+     * @param core A CPU number, or None for the aggregate.
+     * @details Intervals where the CPU was offline are NaN.
+     */
+    [[nodiscard]] fn series(CpuMetric metric, Option<usize> core = {}) const -> Vec<f32>;
+
+   private:
+    /// Ticks a CPU has spent in each state since boot.
+    struct Ticks {
+      u64  busy   = 0;
+      u64  idle   = 0;
+      u64  iowait = 0;
+      u64  steal  = 0;
+      bool online = false; ///< Whether the CPU had a line in the sample.
+    };
+
+    struct Source;
+
+    explicit CpuSampler(UniquePointer<Source> source);
+
+    fn resize(usize cores) -> Unit;
+    [[nodiscard]] fn at(CpuMetric metric, usize slot, usize column) const -> f32;
+    [[nodiscard]] fn load(usize column, usize age) const -> Option<CpuLoad>;
+
+    UniquePointer<Source> m_source;
+
+    usize              m_columns = 0; ///< The aggregate, then one per CPU.
+    Vec<Ticks>         m_previous;
+    Vec<Ticks>         m_current;
+    bool               m_hasBaseline = false;
+    Array<Vec<f32>, 4> m_loads;     ///< Per CpuMetric: HISTORY_SIZE rows of m_columns fractions.
+    usize              m_next  = 0; ///< The row the next interval goes in.
+    usize              m_count = 0;
+  };
+} // namespace draconis::services::sampling
+
+#endif // __linux__
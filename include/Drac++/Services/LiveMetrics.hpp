@@ -0,0 +1,179 @@
+/**
+ * @file LiveMetrics.hpp
+ * @brief Shares frequently polled readouts between processes through a shared-memory snapshot.
+ *
+ * One publisher (`draconis++ --publish`) periodically collects memory usage,
+ * uptime, battery state and the current media, and writes them into a
+ * fixed-layout Snapshot in a POSIX shared-memory segment. Any number of
+ * readers (status bars, prompts, exporters) map the segment once and can then
+ * read the latest values without a single syscall.
+ *
+ * The segment is protected by a seqlock: the publisher bumps a sequence
+ * counter to an odd value, writes the snapshot and bumps it to the next even
+ * value. Readers copy the snapshot and retry if the counter was odd or
+ * changed while they were copying, so they never block the publisher and never
+ * see a torn snapshot.
+ *
+ * @note Only available on POSIX systems.
+ */
+
+#pragma once
+
+#ifndef _WIN32
+
+  #include <chrono>
+  #include <type_traits>
+
+  #include "../Utils/CacheManager.hpp"
+  #include "../Utils/DataTypes.hpp"
+  #include "../Utils/Types.hpp"
+
+namespace draconis::services::metrics {
+  namespace {
+    using utils::cache::CacheManager;
+
+    using utils::types::Array;
+    using utils::types::Battery;
+    using utils::types::i32;
+    using utils::types::i64;
+    using utils::types::Result;
+    using utils::types::String;
+    using utils::types::StringView;
+    using utils::types::u64;
+    using utils::types::u8;
+    using utils::types::UniquePointer;
+    using utils::types::Unit;
+    using utils::types::usize;
+  } // namespace
+
+  /**
+   * @brief The values shared through the segment.
+   *
+   * @details Fixed-size and trivially copyable so its layout is the same in
+   * every process. Each group of fields is only meaningful if its bit is set
+   * in `valid`. Strings are NUL-terminated and truncated to fit.
+   */
+  struct Snapshot {
+    static constexpr u8 MEMORY      = 1U << 0U;
+    static constexpr u8 UPTIME      = 1U << 1U;
+    static constexpr u8 BATTERY     = 1U << 2U;
+    static constexpr u8 NOW_PLAYING = 1U << 3U;
+
+    static constexpr usize TEXT_SIZE = 128;
+
+    i64 publishedAtNs = 0; ///< system_clock time of the last publish, in nanoseconds since the epoch.
+
+    u64 memUsedBytes  = 0;
+    u64 memTotalBytes = 0;
+
+    i64 uptimeSeconds = 0;
+
+    i64 batteryTimeRemaining = -1; ///< Seconds, or -1 if unknown.
+    u8  batteryStatus        = 0;  ///< A Battery::Status value.
+    u8  batteryPercentage    = 0;  ///< Only meaningful if batteryHasPercentage is set.
+    u8  batteryHasPercentage = 0;
+
+    u8 valid = 0; ///< Combination of MEMORY, UPTIME, BATTERY and NOW_PLAYING.
+
+    Array<u8, 4> reserved {};
+
+    Array<char, TEXT_SIZE> title {};
+    Array<char, TEXT_SIZE> artist {};
+
+    [[nodiscard]] fn has(const u8 field) const -> bool {
+      return (valid & field) != 0;
+    }
+
+    [[nodiscard]] fn publishedAt() const -> std::chrono::system_clock::time_point {
+      return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(publishedAtNs)));
+    }
+
+    [[nodiscard]] fn battery() const -> Battery;
+  };
+
+  static_assert(std::is_trivially_copyable_v<Snapshot>);
+  static_assert(sizeof(Snapshot) % sizeof(u64) == 0, "Snapshot is copied through the segment one u64 at a time");
+
+  /**
+   * @brief Name of the shared-memory segment for the current user (e.g. `/draconis++-1000`).
+   */
+  fn DefaultSegmentName() -> String;
+
+  /**
+   * @brief Collects a fresh snapshot using the regular readout functions.
+   * @details Readouts that fail simply leave their bit in Snapshot::valid unset.
+   */
+  fn CollectSnapshot(CacheManager& cache) -> Snapshot;
+
+  /**
+   * @brief Creates the segment and writes snapshots into it.
+   *
+   * @details Only one publisher may hold a segment at a time; it keeps an
+   * advisory lock on it for its lifetime. The segment is removed again when
+   * the publisher is destroyed.
+   */
+  class Publisher {
+   public:
+    /**
+     * @brief Creates the segment named @p name, or takes over one left behind by a publisher that exited without removing it.
+     * @return The publisher; ConfigurationError if another publisher is still using the segment, or an
+     * IoError/PermissionDenied error.
+     */
+    static fn create(StringView name = DefaultSegmentName()) -> Result<UniquePointer<Publisher>>;
+
+    ~Publisher();
+
+    Publisher(const Publisher&)                = delete;
+    Publisher(Publisher&&)                     = delete;
+    fn operator=(const Publisher&)->Publisher& = delete;
+    fn operator=(Publisher&&)->Publisher&      = delete;
+
+    /**
+     * @brief Replaces the shared snapshot with @p snapshot.
+     */
+    fn publish(const Snapshot& snapshot) -> Unit;
+
+   private:
+    Publisher(String name, i32 descriptor, void* segment);
+
+    String m_name;
+    i32    m_fd; ///< Kept open to hold the lock.
+    void*  m_segment;
+  };
+
+  /**
+   * @brief Maps an existing segment read-only and reads snapshots from it.
+   */
+  class Reader {
+   public:
+    /**
+     * @brief Maps the segment named @p name.
+     * @return The reader, or NotFound if no publisher has created the segment,
+     * or CorruptedData if it isn't one of ours.
+     */
+    static fn open(StringView name = DefaultSegmentName()) -> Result<UniquePointer<Reader>>;
+
+    ~Reader();
+
+    Reader(const Reader&)                = delete;
+    Reader(Reader&&)                     = delete;
+    fn operator=(const Reader&)->Reader& = delete;
+    fn operator=(Reader&&)->Reader&      = delete;
+
+    /**
+     * @brief Returns a consistent copy of the latest snapshot.
+     * @return The snapshot, NotFound if nothing has been published yet, or
+     * Timeout if the publisher appears to have died mid-write.
+     * @note Never makes a syscall and never blocks the publisher. Check
+     * Snapshot::publishedAt() to tell whether the publisher is still running.
+     */
+    [[nodiscard]] fn read() const -> Result<Snapshot>;
+
+   private:
+    explicit Reader(const void* segment);
+
+    const void* m_segment;
+  };
+} // namespace draconis::services::metrics
+
+#endif // !_WIN32
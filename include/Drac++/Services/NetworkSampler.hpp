@@ -0,0 +1,160 @@
+/**
+ * @file NetworkSampler.hpp
+ * @brief Per-interface network throughput from repeated counter samples.
+ *
+ * Each call to NetworkSampler::sample() reads the 64-bit byte and packet
+ * counters of every interface and appends them to a small per-interface ring
+ * buffer. Rates are the counter deltas across the samples that fall within a
+ * chosen window, so they're smoothed over that window however irregularly
+ * sample() is called.
+ *
+ * Counters come from one rtnetlink RTM_GETLINK dump on a socket kept open
+ * between samples, or from /sys/class/net/<name>/statistics through a kept
+ * directory descriptor where netlink is unavailable. Neither allocates per
+ * sample once every interface has been seen, so sampling at 10 Hz from a
+ * status bar costs next to nothing.
+ *
+ * @code{.cpp}
+ * Result<NetworkSampler> sampler = NetworkSampler::create();
+ *
+ * while (running) {
+ *   (void)sampler->sample();
+ *
+ *   if (Result<InterfaceThroughput> eth0 = sampler->throughput("eth0"); eth0 && eth0->perSecond)
+ *     draw(eth0->perSecond->rxBytes, eth0->perSecond->txBytes);
+ *
+ *   std::this_thread::sleep_for(100ms);
+ * }
+ * @endcode
+ *
+ * @note Only available on Linux. A sampler isn't thread-safe; use one per thread.
+ */
+
+#pragma once
+
+#ifdef __linux__
+
+  #include <chrono>
+
+  #include "../Utils/Types.hpp"
+
+namespace draconis::services::sampling {
+  namespace {
+    using utils::types::Array;
+    using utils::types::f64;
+    using utils::types::Map;
+    using utils::types::Option;
+    using utils::types::Result;
+    using utils::types::String;
+    using utils::types::StringView;
+    using utils::types::u64;
+    using utils::types::UniquePointer;
+    using utils::types::Unit;
+    using utils::types::usize;
+    using utils::types::Vec;
+
+    using std::chrono::steady_clock;
+  } // namespace
+
+  /**
+   * @brief Cumulative counters of one interface.
+   */
+  struct InterfaceCounters {
+    u64 rxBytes   = 0;
+    u64 txBytes   = 0;
+    u64 rxPackets = 0;
+    u64 txPackets = 0;
+  };
+
+  /**
+   * @brief Counter deltas divided by the time between samples.
+   */
+  struct ThroughputRates {
+    f64 rxBytes   = 0; ///< Per second.
+    f64 txBytes   = 0; ///< Per second.
+    f64 rxPackets = 0; ///< Per second.
+    f64 txPackets = 0; ///< Per second.
+  };
+
+  struct InterfaceThroughput {
+    String                  name;
+    InterfaceCounters       totals;    ///< As of the latest sample.
+    Option<ThroughputRates> perSecond; ///< None until the interface has been sampled twice.
+  };
+
+  class NetworkSampler {
+   public:
+    /// Samples kept per interface; at 10 Hz that covers 1.6 seconds.
+    static constexpr usize HISTORY_SIZE = 16;
+
+    /// Default smoothing window for throughput().
+    static constexpr std::chrono::milliseconds DEFAULT_WINDOW = std::chrono::seconds(1);
+
+    /**
+     * @brief Opens the counter source.
+     * @return The sampler, or an error if neither netlink nor /sys/class/net can be read.
+     */
+    static fn create() -> Result<NetworkSampler>;
+
+    ~NetworkSampler();
+
+    NetworkSampler(const NetworkSampler&)                = delete;
+    NetworkSampler(NetworkSampler&&) noexcept;
+    fn operator=(const NetworkSampler&)->NetworkSampler& = delete;
+    fn operator=(NetworkSampler&&) noexcept -> NetworkSampler&;
+
+    /**
+     * @brief Reads every interface's counters and records them.
+     * @details Interfaces that have disappeared since the last sample are forgotten.
+     */
+    fn sample() -> Result<>;
+
+    /**
+     * @brief Records one set of counters for @p name, as sample() does for each interface.
+     * @details A counter going backwards means the interface was recreated, so its history starts over.
+     */
+    fn record(StringView name, const InterfaceCounters& counters, steady_clock::time_point at) -> Unit;
+
+    /**
+     * @brief Rates for @p name over the recorded samples no older than @p window before the latest one.
+     * @return The throughput, or NotFound if @p name hasn't been sampled.
+     */
+    [[nodiscard]] fn throughput(StringView name, std::chrono::milliseconds window = DEFAULT_WINDOW) const -> Result<InterfaceThroughput>;
+
+    /**
+     * @brief throughput() for every sampled interface, ordered by name.
+     */
+    [[nodiscard]] fn throughput(std::chrono::milliseconds window = DEFAULT_WINDOW) const -> Vec<InterfaceThroughput>;
+
+   private:
+    struct Sample {
+      steady_clock::time_point at;
+      InterfaceCounters        counters;
+    };
+
+    /**
+     * @brief Fixed-size ring of an interface's latest samples.
+     */
+    struct History {
+      Array<Sample, HISTORY_SIZE> samples {};
+      usize                       next       = 0; ///< Where the next sample goes.
+      usize                       count      = 0;
+      u64                         generation = 0; ///< The sample() call that last saw the interface.
+
+      [[nodiscard]] fn latest() const -> const Sample&;
+      [[nodiscard]] fn rates(std::chrono::milliseconds window) const -> Option<ThroughputRates>;
+    };
+
+    struct Source;
+
+    explicit NetworkSampler(UniquePointer<Source> source);
+
+    static fn describe(const String& name, const History& history, std::chrono::milliseconds window) -> InterfaceThroughput;
+
+    UniquePointer<Source> m_source;
+    Map<String, History>  m_histories;
+    u64                   m_generation = 0;
+  };
+} // namespace draconis::services::sampling
+
+#endif // __linux__
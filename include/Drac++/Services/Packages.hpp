@@ -111,6 +111,10 @@ namespace draconis::services::packages {
    * @brief Gets the total package count by querying all relevant package managers.
    * @return Result containing the total package count (u64) on success,
    * or a DracError if aggregation fails (individual errors logged).
+   *
+   * @details Honors the calling thread's CancellationScope: directory scans
+   * and database queries stop early, and a Cancelled or Timeout error is
+   * returned instead of a partial total.
    */
   fn GetTotalCount(CacheManager& cache, Manager enabledPackageManagers) -> Result<u64>;
 
@@ -118,6 +122,9 @@ namespace draconis::services::packages {
    * @brief Gets individual package counts from all enabled package managers.
    * @return Result containing a map of package manager names to their counts on success,
    * or a DracError if all package managers fail (individual errors logged).
+   *
+   * @details If the calling thread's CancellationScope ends the run early, the
+   * managers that weren't counted are left out of the map.
    */
   fn GetIndividualCounts(CacheManager& cache, Manager enabledPackageManagers) -> Result<Map<String, u64>>;
 
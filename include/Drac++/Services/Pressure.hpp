@@ -0,0 +1,193 @@
+/**
+ * @file Pressure.hpp
+ * @brief CPU, memory and IO pressure stall information (PSI).
+ *
+ * Memory usage alone says little about contention: a machine can sit at 95%
+ * used with nothing waiting, or at 60% while tasks stall on reclaim. PSI
+ * reports how much wall time tasks actually spent stalled on each resource,
+ * either system-wide (/proc/pressure/<resource>) or for one cgroup
+ * (<cgroup>/<resource>.pressure).
+ *
+ * Rather than polling the averages, a PressureMonitor registers kernel
+ * triggers ("wake me if tasks stall on memory for 100ms within any 1s") and
+ * sleeps in epoll until one fires.
+ *
+ * @code{.cpp}
+ * Result<Pressure> memory = GetPressure(Resource::Memory);
+ *
+ * Result<PressureMonitor> monitor = PressureMonitor::create();
+ * Result<TriggerId>       trigger = monitor->subscribe({ .resource = Resource::Memory, .threshold = 100ms, .window = 2s });
+ *
+ * while (Result<Vec<TriggerEvent>> events = monitor->wait())
+ *   if (!events->empty())
+ *     shedLoad();
+ * @endcode
+ *
+ * @note Only available on Linux 4.20 or later, built with CONFIG_PSI and not
+ * booted with psi=0. Triggers need 5.2, and unprivileged processes may only
+ * use windows that are a multiple of 2 seconds (6.5+; root only before that).
+ */
+
+#pragma once
+
+#ifdef __linux__
+
+  #include <chrono>
+  #include <filesystem>
+
+  #include "../Utils/Types.hpp"
+
+namespace draconis::services::pressure {
+  namespace {
+    namespace fs = std::filesystem;
+
+    using utils::types::f64;
+    using utils::types::Option;
+    using utils::types::Result;
+    using utils::types::StringView;
+    using utils::types::u64;
+    using utils::types::u8;
+    using utils::types::UniquePointer;
+    using utils::types::Unit;
+    using utils::types::Vec;
+
+    using std::chrono::microseconds;
+    using std::chrono::milliseconds;
+  } // namespace
+
+  enum class Resource : u8 {
+    Cpu,
+    Memory,
+    Io,
+  };
+
+  /**
+   * @brief Which tasks the stall time counts.
+   */
+  enum class Stall : u8 {
+    Some, ///< At least one task was stalled on the resource.
+    Full, ///< Every non-idle task was stalled at once, so nothing productive ran.
+  };
+
+  /**
+   * @brief One line of a pressure file.
+   */
+  struct StallTime {
+    f64          avg10  = 0; ///< Percentage of the last 10 seconds spent stalled.
+    f64          avg60  = 0; ///< Percentage of the last 60 seconds spent stalled.
+    f64          avg300 = 0; ///< Percentage of the last 300 seconds spent stalled.
+    microseconds total {};   ///< Stalled since boot (or since the cgroup was created).
+  };
+
+  struct Pressure {
+    StallTime         some;
+    Option<StallTime> full; ///< None for system-wide CPU pressure on kernels before 5.13.
+  };
+
+  /**
+   * @brief Parses the contents of a pressure file.
+   * @return A ParseError if there's no valid "some" line.
+   */
+  fn ParsePressure(StringView contents) -> Result<Pressure>;
+
+  /**
+   * @brief Reads system-wide pressure on @p resource.
+   * @return UnavailableFeature if the kernel doesn't provide PSI.
+   */
+  fn GetPressure(Resource resource) -> Result<Pressure>;
+
+  /**
+   * @brief Reads pressure on @p resource within the cgroup v2 directory @p cgroup.
+   * @return UnavailableFeature if the kernel doesn't provide PSI, NotFound if @p cgroup doesn't exist.
+   */
+  fn GetCgroupPressure(Resource resource, const fs::path& cgroup) -> Result<Pressure>;
+
+  /**
+   * @brief The cgroup v2 directory the calling process belongs to, e.g. /sys/fs/cgroup/user.slice/...
+   * @return NotSupported if there's no cgroup v2 hierarchy mounted.
+   */
+  fn GetCurrentCgroup() -> Result<fs::path>;
+
+  /**
+   * @brief A stall threshold for the kernel to watch.
+   */
+  struct Trigger {
+    Resource resource;
+    Stall    stall = Stall::Some;
+
+    /// How much stall time within one window fires the trigger; at most the window.
+    microseconds threshold;
+
+    /// Between 500ms and 10s. The trigger fires at most once per window.
+    microseconds window = std::chrono::seconds(2);
+
+    /// A cgroup v2 directory to watch, or None for the whole system.
+    Option<fs::path> cgroup {};
+  };
+
+  using TriggerId = u64;
+
+  struct TriggerEvent {
+    TriggerId trigger;
+    bool      closed = false; ///< The trigger's cgroup was removed; it has been unsubscribed and won't fire again.
+  };
+
+  /**
+   * @brief A set of kernel PSI triggers and an epoll instance to sleep on them.
+   */
+  class PressureMonitor {
+   public:
+    /// While a CancellationScope is active, wait() checks it at least this often.
+    static constexpr milliseconds CANCELLATION_CHECK_INTERVAL = milliseconds(100);
+
+    static fn create() -> Result<PressureMonitor>;
+
+    ~PressureMonitor();
+
+    PressureMonitor(const PressureMonitor&)                = delete;
+    PressureMonitor(PressureMonitor&&) noexcept;
+    fn operator=(const PressureMonitor&)->PressureMonitor& = delete;
+    fn operator=(PressureMonitor&&) noexcept -> PressureMonitor&;
+
+    /**
+     * @brief Registers @p trigger with the kernel.
+     * @return The id wait() reports it with; InvalidArgument if the threshold or window are out of range
+     * (or, for unprivileged processes, the window isn't a multiple of 2s); PermissionDenied if
+     * triggers aren't allowed at all.
+     */
+    fn subscribe(const Trigger& trigger) -> Result<TriggerId>;
+
+    /**
+     * @brief Removes a trigger; it won't be reported again.
+     * @return NotFound if @p trigger isn't subscribed.
+     */
+    fn unsubscribe(TriggerId trigger) -> Result<>;
+
+    /**
+     * @brief Sleeps until a trigger fires, wake() is called or @p timeout passes.
+     *
+     * @details Honors the calling thread's CancellationScope: its deadline
+     * shortens @p timeout, and a stop request is noticed within
+     * CANCELLATION_CHECK_INTERVAL.
+     *
+     * @param timeout None to wait indefinitely.
+     * @return The triggers that fired, which is empty after a timeout or wake(); a Cancelled or Timeout
+     * error if the scope stopped the wait.
+     */
+    fn wait(Option<milliseconds> timeout = {}) -> Result<Vec<TriggerEvent>>;
+
+    /**
+     * @brief Makes a current or the next wait() return early. Safe to call from any thread.
+     */
+    fn wake() const -> Unit;
+
+   private:
+    struct State;
+
+    explicit PressureMonitor(UniquePointer<State> state);
+
+    UniquePointer<State> m_state;
+  };
+} // namespace draconis::services::pressure
+
+#endif // __linux__
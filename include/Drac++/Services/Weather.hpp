@@ -87,6 +87,11 @@ namespace draconis::services::weather {
 
     virtual ~IWeatherService() = default;
 
+    /**
+     * @brief Fetches the current weather, from the cache if it's fresh enough.
+     * @details The HTTP request honors the calling thread's CancellationScope,
+     * returning a Cancelled or Timeout error if it is cut short.
+     */
     [[nodiscard]] virtual fn getWeatherInfo() const -> Result<Report> = 0;
 
    protected:
@@ -1,34 +1,68 @@
 #pragma once
 
 #include <chrono>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <glaze/glaze.hpp>
+#include <source_location>
+#include <type_traits>
+#include <typeindex>
 
+#ifndef _WIN32
+  #include <sys/stat.h> // stat, lstat
+  #include <unistd.h>   // getuid
+#endif
+
+#ifdef __APPLE__
+  #include <sys/sysctl.h> // sysctlbyname
+#endif
+
+#include "CacheStore.hpp"
 #include "DataTypes.hpp"
 #include "Env.hpp"
 #include "Logging.hpp"
 
 namespace draconis::utils::cache {
   namespace {
+    using error::DracError;
+    using error::DracErrorCode;
+
+    using types::Array;
+    using types::Err;
     using types::Fn;
+    using types::Future;
+    using types::i64;
+    using types::List;
     using types::LockGuard;
+    using types::Map;
     using types::Mutex;
     using types::None;
     using types::Option;
     using types::Pair;
     using types::Result;
+    using types::SharedPointer;
     using types::Some;
     using types::String;
+    using types::StringView;
+    using types::Tuple;
+    using types::u16;
+    using types::u32;
     using types::u64;
     using types::u8;
     using types::UniquePointer;
     using types::Unit;
     using types::UnorderedMap;
+    using types::UnorderedSet;
+    using types::usize;
     using types::Vec;
 
     using std::chrono::days;
     using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    using std::chrono::nanoseconds;
     using std::chrono::seconds;
+    using std::chrono::steady_clock;
     using std::chrono::system_clock;
 
     namespace fs = std::filesystem;
@@ -36,14 +70,58 @@ namespace draconis::utils::cache {
 
   enum class CacheLocation : u8 {
     InMemory,      ///< Volatile, lost on app exit. Fastest.
-    TempDirectory, ///< Persists until next reboot or system cleanup.
+    TempDirectory, ///< Persists until next reboot or system cleanup. Kept in CacheManager::getTempCacheDir().
     Persistent     ///< Stored in a user-level cache dir (e.g., ~/.cache).
   };
 
+  /**
+   * @brief How on-disk entries are laid out for the TempDirectory and Persistent locations.
+   */
+  enum class CacheStorage : u8 {
+    MappedFile,  ///< All entries in one memory-mapped file per location (see CacheStore).
+    PerKeyFiles, ///< One BEVE file per key.
+  };
+
   struct CachePolicy {
     CacheLocation location = CacheLocation::Persistent;
 
-    Option<seconds> ttl = days(1); ///< Default to 1 day.
+    Option<seconds> ttl = days(1); ///< Default to 1 day. Zero means successful results aren't cached at all.
+
+    CacheStorage storage = CacheStorage::MappedFile; ///< Ignored for CacheLocation::InMemory.
+
+    /**
+     * @brief How long past its expiry an entry may still be served.
+     *
+     * Within this window an expired entry is returned immediately and a
+     * background refresh is started, instead of making the caller wait for the
+     * fetcher. None (the default) treats expired entries as misses.
+     */
+    Option<seconds> staleWhileRevalidate = None;
+
+    /**
+     * @brief Start a background refresh once an entry is this close to expiring.
+     *
+     * The current value is still returned. None (the default) disables this.
+     */
+    Option<seconds> refreshAhead = None;
+
+    /**
+     * @brief How long a NotFound, NotSupported or ApiUnavailable failure is remembered.
+     *
+     * While remembered, lookups return the same error without calling the
+     * fetcher, so probes for things that aren't there aren't repeated on every
+     * run. Other errors are never cached. None (the default) disables this.
+     */
+    Option<seconds> negativeTtl = None;
+
+    /**
+     * @brief Only trust entries written during the current boot.
+     *
+     * Entries are stamped with CacheManager::getBootId() and treated as misses
+     * once it changes. Where no boot identifier is available, entries are only
+     * reused within the same process.
+     */
+    bool bootScoped = false;
 
     static fn inMemory() -> CachePolicy {
       return { .location = CacheLocation::InMemory, .ttl = None };
@@ -56,6 +134,135 @@ namespace draconis::utils::cache {
     static fn tempDirectory() -> CachePolicy {
       return { .location = CacheLocation::TempDirectory, .ttl = None };
     }
+
+    /**
+     * @brief For facts that can't change without a reboot (kernel, CPU, ...).
+     *
+     * @param base Policy to keep the location and storage of, normally
+     * CacheManager::getGlobalPolicy(); only the expiry is changed.
+     */
+    static fn untilReboot(CachePolicy base) -> CachePolicy {
+      base.ttl        = None;
+      base.bootScoped = true;
+      return base;
+    }
+  };
+
+  /**
+   * @brief Files whose metadata decides whether a cached entry is still valid.
+   *
+   * When passed to CacheManager::getOrSet, the mtime, inode and size of each
+   * source are recorded alongside the entry and re-checked with one `stat` per
+   * source on every lookup. Any difference, including a source appearing or
+   * disappearing, turns the lookup into a miss regardless of the entry's TTL.
+   */
+  struct CacheValidator {
+    Vec<fs::path> sources;
+  };
+
+  /**
+   * @brief Metadata snapshot of one CacheValidator source.
+   * @details All numeric fields are zero if the source did not exist.
+   */
+  struct SourceStamp {
+    String path;
+    i64    mtimeNs = 0;
+    u64    inode   = 0;
+    u64    size    = 0;
+
+    fn operator==(const SourceStamp&) const -> bool = default;
+  };
+
+  /**
+   * @brief Counters collected for one cache key. See CacheManager::stats().
+   */
+  struct CacheKeyStats {
+    /// Upper bounds of the fetchLatency buckets. The final bucket holds everything slower.
+    static constexpr Array<microseconds, 5> FETCH_LATENCY_BOUNDS = {
+      microseconds(100), microseconds(1'000), microseconds(10'000), microseconds(100'000), microseconds(1'000'000)
+    };
+
+    u64 memoryHits     = 0; ///< Lookups served from the in-memory tier.
+    u64 diskHits       = 0; ///< Lookups served from the on-disk tier.
+    u64 misses         = 0; ///< Lookups that had to run the fetcher.
+    u64 fetchFailures  = 0; ///< Fetcher runs (including refreshes) that returned an error.
+    u64 refreshes      = 0; ///< Background refreshes started by staleWhileRevalidate/refreshAhead.
+    u64 decodeFailures = 0; ///< On-disk entries that could not be decoded.
+    u64 bytesRead      = 0; ///< Serialized bytes read from disk.
+    u64 bytesWritten   = 0; ///< Serialized bytes written to disk.
+    u64 fetchNs        = 0; ///< Total time spent in the fetcher.
+    u64 evictions      = 0; ///< Times the in-memory entry was dropped to stay within the MemoryBudget.
+
+    Array<u64, FETCH_LATENCY_BOUNDS.size() + 1> fetchLatency {}; ///< Fetcher run times, bucketed by FETCH_LATENCY_BOUNDS.
+  };
+
+  /**
+   * @brief Limits on CacheManager's in-memory tier.
+   *
+   * Once either limit is exceeded, entries that can no longer be served are
+   * dropped first, then the least recently used ones. Entries evicted from
+   * memory are still on disk for non-InMemory policies. Sizes are estimates:
+   * strings and containers are counted, heap memory owned by other members
+   * of a cached struct is not.
+   */
+  struct MemoryBudget {
+    usize maxEntries = 4096;             ///< 0 for no limit.
+    usize maxBytes   = 16 * 1024 * 1024; ///< 0 for no limit.
+  };
+
+  /**
+   * @brief A failure remembered under CachePolicy::negativeTtl.
+   */
+  struct CachedError {
+    u8     code = 0; ///< The DracErrorCode, as its underlying value.
+    String message;
+  };
+
+  /**
+   * @brief Whether values of @p T are stored on disk as their raw bytes rather than as BEVE.
+   *
+   * A raw entry is only meaningful to another process if the bytes are plain
+   * data, so this is opt-in: arithmetic and enum types are raw, and any other
+   * type must specialize this (usually by deriving from RawLayoutVersion).
+   * Never opt in a type holding pointers, views or spans.
+   *
+   * @c version is part of the entry's fingerprint. Bump it whenever the type's
+   * fields change, so entries written with the old layout are re-fetched
+   * rather than misread.
+   */
+  template <typename T>
+  struct RawCacheLayout {
+    static constexpr bool enabled = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+    static constexpr u32  version = 0;
+  };
+
+  template <u32 Version>
+  struct RawLayoutVersion {
+    static constexpr bool enabled = true;
+    static constexpr u32  version = Version;
+  };
+
+  template <>
+  struct RawCacheLayout<types::CPUCores> : RawLayoutVersion<1> {};
+
+  template <>
+  struct RawCacheLayout<types::ResourceUsage> : RawLayoutVersion<1> {};
+
+  template <>
+  struct RawCacheLayout<types::DisplayInfo> : RawLayoutVersion<1> {};
+
+  template <>
+  struct RawCacheLayout<types::DisplayInfo::Resolution> : RawLayoutVersion<1> {};
+
+  /**
+   * @brief One key for CacheManager::getOrSetMany(). The fields mean the same as getOrSet()'s arguments.
+   */
+  template <typename T>
+  struct CacheRequest {
+    String              key;
+    Fn<Result<T>()>     fetcher;
+    Option<CachePolicy> policy    = None;
+    CacheValidator      validator = {};
   };
 
   class CacheManager {
@@ -72,131 +279,302 @@ namespace draconis::utils::cache {
 
     CacheManager() : m_globalPolicy { .location = CacheLocation::Persistent, .ttl = days(1) } {}
 
-    fn setGlobalPolicy(const CachePolicy& policy) -> Unit {
-      LockGuard lock(m_cacheMutex);
-      m_globalPolicy = policy;
+    /**
+     * @brief Identifier of the current boot, used by CachePolicy::bootScoped.
+     *
+     * This is /proc/sys/kernel/random/boot_id on Linux and the
+     * kern.bootsessionuuid sysctl on macOS. None elsewhere. Read once per
+     * process.
+     */
+    static fn getBootId() -> const Option<String>& {
+      static const Option<String> BOOT_ID = []() -> Option<String> {
+#ifdef __linux__
+        std::ifstream ifs("/proc/sys/kernel/random/boot_id");
+
+        if (String bootId; std::getline(ifs, bootId) && !bootId.empty())
+          return bootId;
+#elif defined(__APPLE__)
+        Array<char, 64> uuid {};
+        usize           size = uuid.size();
+
+        if (sysctlbyname("kern.bootsessionuuid", uuid.data(), &size, nullptr, 0) == 0 && uuid.front() != '\0')
+          return String(uuid.data());
+#endif
+
+        return None;
+      }();
+
+      return BOOT_ID;
     }
 
-    template <typename T>
-    struct CacheEntry {
-      T           data;
-      Option<u64> expires; // store as UNIX timestamp (seconds since epoch), None if no expiry
-    };
+    /**
+     * @brief Directory holding this user's CacheLocation::TempDirectory entries.
+     *
+     * A per-user subdirectory of the system temp directory, so clearing the
+     * cache only ever looks at our own files. On POSIX systems it is created
+     * with mode 0700 and ignored if another user owns it.
+     */
+    static fn getTempCacheDir() -> fs::path {
+#ifdef _WIN32
+      // %TEMP% is already per-user.
+      return fs::temp_directory_path() / "draconis++";
+#else
+      return fs::temp_directory_path() / std::format("draconis++-{}", getuid());
+#endif
+    }
 
-    template <typename T>
-    fn getOrSet(
-      const String&       key,
-      Option<CachePolicy> overridePolicy,
-      Fn<Result<T>()>     fetcher
-    ) -> Result<T> {
-      if constexpr (DRAC_ENABLE_CACHING) {
-        /* Early-exit if caching is globally disabled for this run. */
-        if (ignoreCache)
-          return fetcher();
+    /**
+     * @brief Waits for any background refreshes still running.
+     */
+    ~CacheManager() {
+      Vec<Future<Unit>> tasks;
 
+      {
         LockGuard lock(m_cacheMutex);
+        tasks.swap(m_refreshTasks);
+      }
 
-        const CachePolicy& policy = overridePolicy.value_or(m_globalPolicy);
+      for (Future<Unit>& task : tasks)
+        task.wait();
+    }
 
-        // 1. Check in-memory cache
-        if (const auto iter = m_inMemoryCache.find(key); iter != m_inMemoryCache.end())
-          if (
-            CacheEntry<T> entry; glz::read_beve(entry, iter->second.first) == glz::error_code::none &&
-            (!entry.expires.has_value() || system_clock::now() < system_clock::time_point(seconds(*entry.expires)))
-          )
-            return entry.data;
+    CacheManager(const CacheManager&)                = delete;
+    CacheManager(CacheManager&&)                     = delete;
+    fn operator=(const CacheManager&)->CacheManager& = delete;
+    fn operator=(CacheManager&&)->CacheManager&      = delete;
 
-        // 2. Check filesystem cache
-        const Option<fs::path> filePath = getCacheFilePath(key, policy.location);
+    fn setGlobalPolicy(const CachePolicy& policy) -> Unit {
+      LockGuard lock(m_cacheMutex);
+      m_globalPolicy = policy;
+    }
 
-        if (filePath && fs::exists(*filePath)) {
-          if (std::ifstream ifs(*filePath, std::ios::binary); ifs) {
-            std::string fileContents((std::istreambuf_iterator<char>(ifs)), {});
+    [[nodiscard]] fn getGlobalPolicy() const -> CachePolicy {
+      LockGuard lock(m_cacheMutex);
+      return m_globalPolicy;
+    }
 
-            CacheEntry<T> entry;
+    /**
+     * @brief Uses @p policy for every key that starts with @p prefix.
+     *
+     * Meant for applications tuning a family of lookups, e.g. serving weather
+     * stale while it refreshes, without touching the rest of the cache. Where
+     * several prefixes match, the longest does.
+     *
+     * A key policy replaces the global policy outright. A call that passes its
+     * own policy to getOrSet() keeps it, and only takes staleWhileRevalidate
+     * and refreshAhead from the key policy, so e.g. a package count stays
+     * source-validated and keeps remembering a missing package manager.
+     */
+    fn setKeyPolicy(const String& prefix, const CachePolicy& policy) -> Unit {
+      LockGuard lock(m_cacheMutex);
+      m_keyPolicies.insert_or_assign(prefix, policy);
+    }
 
-            if (glz::read_beve(entry, fileContents) == glz::error_code::none) {
-              if (!entry.expires.has_value() || system_clock::now() < system_clock::time_point(seconds(*entry.expires))) {
-                system_clock::time_point expiryTp = entry.expires.has_value() ? system_clock::time_point(seconds(*entry.expires)) : system_clock::time_point::max();
+    /**
+     * @brief Returns a snapshot of the counters collected so far, by key.
+     *
+     * Counting starts when the manager is created (or at the last resetStats())
+     * and covers every getOrSet() call except those made while ignoreCache is
+     * set.
+     */
+    [[nodiscard]] fn stats() const -> Map<String, CacheKeyStats> {
+      LockGuard lock(m_statsMutex);
+      return { m_stats.begin(), m_stats.end() };
+    }
 
-                m_inMemoryCache[key] = { fileContents, expiryTp };
+    fn resetStats() -> Unit {
+      LockGuard lock(m_statsMutex);
+      m_stats.clear();
+    }
 
-                return entry.data;
-              }
-            }
-          }
-        }
+    /**
+     * @brief Replaces the in-memory limits, evicting right away if they are already exceeded.
+     */
+    fn setMemoryBudget(const MemoryBudget& budget) -> Unit {
+      Vec<String> evicted;
 
-        // 3. Cache miss: call fetcher (move the callable to indicate consumption)
-        Result<T> fetchedResult = fetcher();
+      {
+        LockGuard lock(m_cacheMutex);
+        m_memoryBudget = budget;
+        evicted        = enforceBudgetLocked(None);
+      }
 
-        if (!fetchedResult)
-          return fetchedResult;
+      recordEvictions(evicted);
+    }
 
-        // 4. Store in cache
-        Option<u64> expiryTs;
-        if (policy.ttl.has_value()) {
-          system_clock::time_point now        = system_clock::now();
-          system_clock::time_point expiryTime = now + *policy.ttl;
+    /**
+     * @brief Drops in-memory entries that can no longer be served, even stale.
+     * @return The number of entries removed.
+     * @note This also runs on its own when storing, at most once per PURGE_INTERVAL.
+     */
+    fn purgeExpired() -> usize {
+      LockGuard lock(m_cacheMutex);
+      return purgeExpiredLocked(system_clock::now());
+    }
 
-          expiryTs = duration_cast<seconds>(expiryTime.time_since_epoch()).count();
-        }
+    /**
+     * @brief Number of in-memory entries and their estimated size in bytes.
+     */
+    fn memoryUsage() -> Pair<usize, usize> {
+      LockGuard lock(m_cacheMutex);
+      return { m_inMemoryCache.size(), m_memoryBytes };
+    }
 
-        CacheEntry<T> newEntry {
-          .data    = *fetchedResult,
-          .expires = expiryTs
-        };
+    static constexpr seconds PURGE_INTERVAL = seconds(60);
 
-        std::string binaryBuffer;
-        glz::write_beve(newEntry, binaryBuffer);
+    template <typename T>
+    struct CacheEntry {
+      T                   data;
+      Option<u64>         expires; // store as UNIX timestamp (seconds since epoch), None if no expiry
+      Vec<SourceStamp>    sources; // CacheValidator snapshot taken before the value was fetched
+      Option<CachedError> error;   // Set (and data left default) if this entry remembers a failure
+    };
 
-        system_clock::time_point inMemoryExpiryTp = expiryTs.has_value()
-          ? system_clock::time_point(seconds(*expiryTs))
-          : system_clock::time_point::max();
+    /**
+     * @brief Returns the cached value for @p key, or calls @p fetcher to produce it.
+     *
+     * The manager mutex is only held for map lookups and updates, never while
+     * reading from disk or running the fetcher. Concurrent callers for the same
+     * key are serialised on a per-key lock, so only the first one runs the
+     * fetcher and the rest pick up its result; callers for other keys proceed
+     * without waiting. The per-key lock is not recursive, so @p fetcher must not
+     * call getOrSet() (or getOrSetMany()) for @p key itself, or it deadlocks.
+     *
+     * If the policy sets CachePolicy::staleWhileRevalidate or
+     * CachePolicy::refreshAhead, @p fetcher may also be run later on a
+     * background thread. It must then not capture anything by reference that
+     * could be gone by the time it runs.
+     *
+     * If @p validator names any sources, an entry is only served while they
+     * are unchanged since it was fetched (see CacheValidator).
+     *
+     * If the policy sets CachePolicy::negativeTtl, NotFound, NotSupported and
+     * ApiUnavailable failures are cached too and returned as-is until they
+     * expire.
+     */
+    template <typename T>
+    fn getOrSet(
+      const String&         key,
+      Option<CachePolicy>   overridePolicy,
+      const CacheValidator& validator,
+      Fn<Result<T>()>       fetcher
+    ) -> Result<T> {
+      if constexpr (DRAC_ENABLE_CACHING) {
+        /* Early-exit if caching is globally disabled for this run. */
+        if (ignoreCache)
+          return fetcher();
 
-        m_inMemoryCache[key] = { binaryBuffer, inMemoryExpiryTp };
+        const Lookup<T> lookup = makeLookup(key, overridePolicy, validator, fetcher);
 
-        if (policy.location != CacheLocation::InMemory) {
-          fs::create_directories(filePath->parent_path());
-          std::ofstream ofs(*filePath, std::ios::binary | std::ios::trunc);
-          ofs.write(binaryBuffer.data(), static_cast<std::streamsize>(binaryBuffer.size()));
-        }
+        // 1. Check in-memory cache
+        if (Option<Result<T>> cached = lookupMemory(lookup))
+          return std::move(*cached);
 
-        return fetchedResult;
+        return resolve(lookup);
       } else {
         (void)key;
         (void)overridePolicy;
+        (void)validator;
         return fetcher();
       }
     }
 
+    template <typename T>
+    fn getOrSet(const String& key, Option<CachePolicy> overridePolicy, Fn<Result<T>()> fetcher) -> Result<T> {
+      return getOrSet(key, std::move(overridePolicy), CacheValidator {}, std::move(fetcher));
+    }
+
     template <typename T>
     fn getOrSet(const String& key, Fn<Result<T>()> fetcher) -> Result<T> {
       return getOrSet(key, None, fetcher);
     }
 
+    /**
+     * @brief Resolves several keys at once, returning their results in order.
+     *
+     * All memory and disk hits are served first, in one pass. The misses are
+     * then fetched concurrently, and everything written to disk as a result
+     * goes out in a single flush at the end (see WriteBatch). Each request
+     * otherwise behaves exactly like the matching getOrSet() call.
+     */
+    template <typename... Ts>
+    fn getOrSetMany(const CacheRequest<Ts>&... requests) -> Tuple<Result<Ts>...> {
+      if constexpr (DRAC_ENABLE_CACHING) {
+        if (ignoreCache)
+          return Tuple<Result<Ts>...> { requests.fetcher()... };
+
+        return resolveMany(std::index_sequence_for<Ts...> {}, requests...);
+      } else
+        return Tuple<Result<Ts>...> { requests.fetcher()... };
+    }
+
+    /**
+     * @brief Queues this manager's on-disk writes while alive and writes them together when the outermost batch ends.
+     *
+     * For the mapped store this turns one lock, write, header update and remap
+     * per entry into one for the whole batch. Batches nest; lookups made during
+     * a batch still see the queued values through the in-memory tier.
+     */
+    class WriteBatch {
+     public:
+      explicit WriteBatch(CacheManager& owner)
+        : m_owner(owner) {
+        LockGuard lock(m_owner.m_batchMutex);
+        ++m_owner.m_batchDepth;
+      }
+
+      ~WriteBatch() {
+        m_owner.endBatch();
+      }
+
+      WriteBatch(const WriteBatch&)                = delete;
+      WriteBatch(WriteBatch&&)                     = delete;
+      fn operator=(const WriteBatch&)->WriteBatch& = delete;
+      fn operator=(WriteBatch&&)->WriteBatch&      = delete;
+
+     private:
+      CacheManager& m_owner;
+    };
+
     /**
      * @brief Remove a cached entry corresponding to the given key.
      *
      * This erases the entry from the in-memory cache and also attempts to
-     * remove any corresponding files in the temporary and persistent cache
-     * locations (if they exist).
+     * remove it from the temporary and persistent cache locations, both from
+     * the mapped store files and from any per-key files (if they exist).
      *
      * @param key Cache key to invalidate.
      */
     fn invalidate(const String& key) -> Unit {
       if constexpr (DRAC_ENABLE_CACHING) {
-        LockGuard lock(m_cacheMutex);
+        // Wait for any in-flight fetch of this key so it cannot re-populate the entry afterwards.
+        const KeyLock keyLock(*this, key);
+
+        {
+          LockGuard lock(m_batchMutex);
+          std::erase_if(m_pendingWrites, [&key](const PendingWrite& write) { return write.key == key; });
+        }
+
+        {
+          LockGuard lock(m_cacheMutex);
 
-        // Erase from in-memory cache (no harm if the key is absent).
-        m_inMemoryCache.erase(key);
+          // Erase from in-memory cache (no harm if the key is absent).
+          if (const auto iter = m_inMemoryCache.find(key); iter != m_inMemoryCache.end())
+            eraseFromMemoryLocked(iter);
+        }
 
         // Attempt to remove the on-disk copies for both possible locations.
-        for (const CacheLocation loc : { CacheLocation::TempDirectory, CacheLocation::Persistent })
+        for (const CacheLocation loc : { CacheLocation::TempDirectory, CacheLocation::Persistent }) {
           if (const Option<fs::path> filePath = getCacheFilePath(key, loc); filePath && fs::exists(*filePath)) {
             std::error_code errc;
             fs::remove(*filePath, errc);
           }
+
+          // Don't create a store just to erase from it.
+          if (fs::exists(getStoreFilePath(loc)))
+            if (const SharedPointer<CacheStore> store = getStore(loc))
+              (void)store->erase(key);
+        }
       } else {
         (void)key;
       }
@@ -205,9 +583,10 @@ namespace draconis::utils::cache {
     /**
      * @brief Remove **all** cached data – both in-memory and on-disk.
      *
-     * This clears the in-memory cache map and removes all files from the
-     * persistent and temporary cache directories while preserving the
-     * directory structure.
+     * This clears the in-memory cache map, removes all files from the
+     * persistent cache directory, and removes the temp-directory store along
+     * with the per-key files listed in its manifest. Nothing else in the
+     * system temp directory is looked at.
      */
     fn invalidateAll(bool logRemovals = false) -> u8 {
       if constexpr (DRAC_ENABLE_CACHING) {
@@ -215,22 +594,33 @@ namespace draconis::utils::cache {
 
         u8 removedCount = 0;
 
-        // Record keys currently present so we can clean their temp-dir copies
-        // after we clear the map.
-        Vec<String> keys;
-        keys.reserve(m_inMemoryCache.size());
-        for (const auto& [key, val] : m_inMemoryCache)
-          keys.emplace_back(key);
-
         // Clear in-memory cache.
         m_inMemoryCache.clear();
+        m_lru.clear();
+        m_memoryBytes = 0;
+
+        {
+          LockGuard batchLock(m_batchMutex);
+          m_pendingWrites.clear();
+        }
+
+        // Drop our mappings and manifest; the files themselves are removed below.
+        Vec<String> tempKeys;
+
+        {
+          LockGuard storeLock(m_storeMutex);
+          m_stores = {};
+
+          loadManifestLocked();
+          tempKeys.assign(m_manifestKeys.begin(), m_manifestKeys.end());
+
+          m_manifestKeys.clear();
+          m_manifestLoaded = false;
+          m_tempDirUsable  = None;
+        }
 
         // Remove all files from persistent cache directory.
-#ifdef __APPLE__
-        const fs::path persistentDir = std::format("{}/Library/Caches/draconis++", draconis::utils::env::GetEnv("HOME").value_or("."));
-#else
-        const fs::path persistentDir = std::format("{}/.cache/draconis++", draconis::utils::env::GetEnv("HOME").value_or("."));
-#endif
+        const fs::path persistentDir = getPersistentCacheDir();
 
         if (fs::exists(persistentDir)) {
           std::error_code errc;
@@ -243,38 +633,32 @@ namespace draconis::utils::cache {
             }
         }
 
-        // Remove all files from temp directory that match our cache pattern.
-        const fs::path tempDir = fs::temp_directory_path();
-        if (fs::exists(tempDir)) {
+        // Remove the temp-directory store and every per-key file we recorded writing.
+        const fs::path tempDir = getTempCacheDir();
+
+        Vec<fs::path> tempFiles;
+        tempFiles.reserve(tempKeys.size() + 1);
+        tempFiles.push_back(getStoreFilePath(CacheLocation::TempDirectory));
+
+        for (const String& key : tempKeys)
+          tempFiles.push_back(tempDir / key);
+
+        for (const fs::path& file : tempFiles) {
           std::error_code errc;
-          for (const fs::directory_entry& entry : fs::directory_iterator(tempDir, errc)) {
-            if (entry.is_regular_file()) {
-              // Check if this file is one of our cache files by looking at known keys
-              // or by checking if it's a file we might have created
-              bool shouldRemove = false;
-
-              // Remove files that match our known keys
-              for (const String& key : keys)
-                if (entry.path().filename() == key) {
-                  shouldRemove = true;
-                  break;
-                }
-
-              // Also remove any files that might be orphaned cache files
-              // (files that don't have extensions and are likely our cache files)
-              if (!shouldRemove && entry.path().extension().empty())
-                shouldRemove = true;
-
-              if (shouldRemove) {
-                fs::remove(entry.path(), errc);
-                removedCount++;
-                if (logRemovals)
-                  logging::Println("Removed temp-directory cache file: {}", entry.path().string());
-              }
-            }
+
+          if (fs::remove(file, errc)) {
+            removedCount++;
+            if (logRemovals)
+              logging::Println("Removed temp-directory cache file: {}", file.string());
           }
         }
 
+        {
+          std::error_code errc;
+          fs::remove(getManifestPath(), errc);
+          fs::remove(tempDir, errc); // Only succeeds once it's empty.
+        }
+
         return removedCount;
       } else {
         (void)logRemovals;
@@ -283,77 +667,1181 @@ namespace draconis::utils::cache {
     }
 
    private:
-    CachePolicy m_globalPolicy;
+    /**
+     * @brief Per-key lock shared by every caller currently working on that key.
+     *
+     * @details Entries live in m_inFlight only while at least one caller holds or
+     * waits for them, so the map never grows beyond the number of keys being
+     * fetched concurrently.
+     */
+    struct InFlight {
+      Mutex mutex;
+      usize users = 0; ///< Guarded by m_cacheMutex.
+    };
 
-    UnorderedMap<String, Pair<String, system_clock::time_point>> m_inMemoryCache;
+    /**
+     * @brief RAII guard that acquires the per-key lock for a cache key.
+     */
+    class KeyLock {
+     public:
+      KeyLock(CacheManager& owner, const String& key)
+        : m_owner(owner), m_key(key) {
+        {
+          LockGuard lock(m_owner.m_cacheMutex);
+          m_flight = &m_owner.m_inFlight.try_emplace(m_key).first->second;
+          ++m_flight->users;
+        }
 
-    Mutex m_cacheMutex;
+        m_flight->mutex.lock();
+      }
 
-    static fn getCacheFilePath(const String& key, const CacheLocation location) -> Option<fs::path> {
-      using matchit::match, matchit::is, matchit::_;
+      ~KeyLock() {
+        m_flight->mutex.unlock();
 
-      Option<fs::path> cacheDir = None;
+        LockGuard lock(m_owner.m_cacheMutex);
 
-      if (location == CacheLocation::InMemory)
-        return None; // In-memory cache does not have a file path
+        if (--m_flight->users == 0)
+          m_owner.m_inFlight.erase(m_key);
+      }
 
-      if (location == CacheLocation::TempDirectory)
-        return Some(fs::temp_directory_path() / key);
+      KeyLock(const KeyLock&)                = delete;
+      KeyLock(KeyLock&&)                     = delete;
+      fn operator=(const KeyLock&)->KeyLock& = delete;
+      fn operator=(KeyLock&&)->KeyLock&      = delete;
 
-      if (location == CacheLocation::Persistent)
-#ifdef __APPLE__
-        return Some(std::format("{}/Library/Caches/draconis++/{}", draconis::utils::env::GetEnv("HOME").value_or("."), key));
-#else
-        return Some(std::format("{}/.cache/draconis++/{}", draconis::utils::env::GetEnv("HOME").value_or("."), key));
-#endif
+     private:
+      CacheManager& m_owner;
+      String        m_key;
+      InFlight*     m_flight = nullptr;
+    };
 
-      if (cacheDir) {
-        fs::create_directories(*cacheDir);
-        return *cacheDir / key;
-      }
+    /**
+     * @brief A decoded in-memory cache entry.
+     *
+     * @details The value is kept as the type it was fetched as, so hits never
+     * touch BEVE. Lookups check @c type against the requested type and treat
+     * a mismatch as a miss.
+     */
+    struct MemoryEntry {
+      SharedPointer<const void> value;                ///< Points to a `const T`, null if @c error is set.
+      std::type_index           type = typeid(void); ///< typeid of the stored `T`.
+      system_clock::time_point  expiry;               ///< time_point::max() if the entry never expires.
+      system_clock::time_point  retainUntil;          ///< When the entry can no longer be served, even stale.
+      Vec<SourceStamp>          sources;              ///< CacheValidator snapshot, empty if none was given.
+      Option<CachedError>       error;                ///< Set if this entry remembers a failure.
+      usize                     bytes = 0;            ///< Estimated footprint, counted against MemoryBudget::maxBytes.
+      List<String>::iterator    lruPos;               ///< Position in m_lru.
+    };
 
-      return None;
-    }
-  };
-} // namespace draconis::utils::cache
+    /**
+     * @brief A value (or remembered failure) copied out of the in-memory tier, along with its expiry.
+     */
+    template <typename T>
+    struct MemoryHit {
+      Result<T>                value;
+      system_clock::time_point expiry;
+      Vec<SourceStamp>         sources;
+    };
 
-namespace glz {
-  template <>
-  struct meta<draconis::utils::types::OSInfo> {
-    using T = draconis::utils::types::OSInfo;
+    enum class Freshness : u8 {
+      Fresh,        ///< Serve as-is.
+      NeedsRefresh, ///< Serve, but refresh in the background (stale, or within the refresh-ahead window).
+      Expired,      ///< Don't serve; fetch synchronously.
+    };
 
-    // clang-format off
-    static constexpr detail::Object value = object(
-      "name", &T::name,
-      "version", &T::version,
-      "id", &T::id
-    );
-    // clang-format on
-  };
+    /**
+     * @brief Everything needed to resolve one key, shared by getOrSet() and getOrSetMany().
+     */
+    template <typename T>
+    struct Lookup {
+      const String&          key;
+      CachePolicy            policy;
+      const CacheValidator&  validator;
+      Vec<SourceStamp>       stamps; ///< Taken before any fetch, so a change made while fetching invalidates the result next time.
+      const Fn<Result<T>()>& fetcher;
+    };
 
-  template <>
-  struct meta<draconis::utils::types::CPUCores> {
-    using T = draconis::utils::types::CPUCores;
+    /**
+     * @brief An on-disk write, queued while a WriteBatch is active.
+     */
+    struct PendingWrite {
+      String        key;
+      CacheLocation location;
+      CacheStorage  storage;
+      String        bytes;
+    };
 
-    static constexpr detail::Object value = object("physical", &T::physical, "logical", &T::logical);
-  };
+    CachePolicy                       m_globalPolicy;
+    UnorderedMap<String, CachePolicy> m_keyPolicies; ///< By key prefix. See setKeyPolicy().
 
-  template <>
-  struct meta<draconis::utils::types::NetworkInterface> {
-    using T = draconis::utils::types::NetworkInterface;
+    UnorderedMap<String, MemoryEntry> m_inMemoryCache;
 
-    // clang-format off
-    static constexpr detail::Object value = object(
-      "name",        &T::name,
-      "isUp",        &T::isUp,
-      "isLoopback",  &T::isLoopback,
-      "ipv4Address", &T::ipv4Address,
-      "macAddress",  &T::macAddress
-    );
-    // clang-format on
-  };
+    // The rest of the in-memory bookkeeping, guarded by m_cacheMutex like the map itself.
+    MemoryBudget             m_memoryBudget;
+    List<String>             m_lru;             ///< Keys of m_inMemoryCache, most recently used first.
+    usize                    m_memoryBytes = 0; ///< Sum of MemoryEntry::bytes.
+    system_clock::time_point m_nextPurge;       ///< When storeInMemory() next calls purgeExpiredLocked().
 
-  template <>
+    UnorderedMap<String, InFlight> m_inFlight;
+
+    mutable Mutex m_cacheMutex;
+
+    /// Lazily opened stores for TempDirectory and Persistent, indexed by getStoreIndex().
+    Array<SharedPointer<CacheStore>, 2> m_stores;
+
+    Mutex m_storeMutex; ///< Guards m_stores and the temp-directory state below. Never held together with a store's own lock.
+
+    Option<bool>         m_tempDirUsable;          ///< Whether getTempCacheDir() exists and is ours; None until first checked.
+    UnorderedSet<String> m_manifestKeys;           ///< Keys listed in the temp-directory manifest.
+    bool                 m_manifestLoaded = false; ///< Whether m_manifestKeys has been read from disk yet.
+
+    UnorderedSet<String> m_refreshing;   ///< Keys with a background refresh queued or running. Guarded by m_cacheMutex.
+    Vec<Future<Unit>>    m_refreshTasks; ///< Background refreshes, waited for on destruction. Guarded by m_cacheMutex.
+
+    UnorderedMap<String, CacheKeyStats> m_stats;
+    mutable Mutex                       m_statsMutex; ///< Guards m_stats. Never held together with another lock.
+
+    Mutex             m_batchMutex;     ///< Guards m_batchDepth and m_pendingWrites. May be taken under m_cacheMutex, never the other way round.
+    usize             m_batchDepth = 0; ///< Number of live WriteBatch objects.
+    Vec<PendingWrite> m_pendingWrites;  ///< Writes queued until the outermost WriteBatch ends.
+
+    template <typename T>
+    fn makeLookup(const String& key, const Option<CachePolicy>& overridePolicy, const CacheValidator& validator, const Fn<Result<T>()>& fetcher) -> Lookup<T> {
+      CachePolicy policy;
+
+      {
+        LockGuard lock(m_cacheMutex);
+        policy = overridePolicy.value_or(m_globalPolicy);
+
+        const CachePolicy* keyPolicy = nullptr;
+        usize              matched   = 0;
+
+        for (const auto& [prefix, candidate] : m_keyPolicies)
+          if (key.starts_with(prefix) && prefix.size() >= matched) {
+            keyPolicy = &candidate;
+            matched   = prefix.size();
+          }
+
+        if (keyPolicy && overridePolicy) {
+          policy.staleWhileRevalidate = keyPolicy->staleWhileRevalidate;
+          policy.refreshAhead         = keyPolicy->refreshAhead;
+        } else if (keyPolicy)
+          policy = *keyPolicy;
+      }
+
+      return { .key = key, .policy = policy, .validator = validator, .stamps = stampSources(policy, validator), .fetcher = fetcher };
+    }
+
+    /**
+     * @brief Returns the cached value in @p hit unless it is past serving,
+     * starting a background refresh if it is stale or about to expire.
+     */
+    template <typename T>
+    fn serveHit(const Lookup<T>& lookup, Option<MemoryHit<T>>& hit) -> Option<Result<T>> {
+      if (!hit || hit->sources != lookup.stamps)
+        return None;
+
+      // Remembered failures are never served stale or refreshed in the background.
+      if (!hit->value)
+        return system_clock::now() < hit->expiry ? Option<Result<T>>(std::move(hit->value)) : None;
+
+      const Freshness freshness = classify(hit->expiry, lookup.policy);
+
+      if (freshness == Freshness::Expired)
+        return None;
+
+      if (freshness == Freshness::NeedsRefresh)
+        scheduleRefresh<T>(lookup.key, lookup.policy, lookup.validator, lookup.fetcher);
+
+      return std::move(hit->value);
+    }
+
+    template <typename T>
+    fn lookupMemory(const Lookup<T>& lookup) -> Option<Result<T>> {
+      Option<MemoryHit<T>> hit    = readFromMemory<T>(lookup.key);
+      Option<Result<T>>    cached = serveHit(lookup, hit);
+
+      if (cached)
+        recordStats(lookup.key, [](CacheKeyStats& stats) { ++stats.memoryHits; });
+
+      return cached;
+    }
+
+    template <typename T>
+    fn lookupDisk(const Lookup<T>& lookup) -> Option<Result<T>> {
+      const Option<String> fileContents = readFromDisk(lookup.key, lookup.policy);
+
+      if (!fileContents)
+        return None;
+
+      CacheEntry<T> entry;
+
+      const bool decoded = decodeEntry(*fileContents, entry);
+
+      recordStats(lookup.key, [&](CacheKeyStats& stats) {
+        stats.bytesRead += fileContents->size();
+
+        if (!decoded)
+          ++stats.decodeFailures;
+      });
+
+      if (!decoded)
+        return None;
+
+      const system_clock::time_point expiryTp = entry.expires.has_value() ? system_clock::time_point(seconds(*entry.expires)) : system_clock::time_point::max();
+
+      if (entry.sources != lookup.stamps || classify(expiryTp, lookup.policy) == Freshness::Expired)
+        return None;
+
+      Result<T> value = entry.error ? Result<T>(toError(*entry.error)) : Result<T>(std::move(entry.data));
+
+      storeInMemory<T>(lookup.key, lookup.policy, value, expiryTp, entry.sources);
+
+      Option<MemoryHit<T>> hit    = MemoryHit<T> { .value = std::move(value), .expiry = expiryTp, .sources = std::move(entry.sources) };
+      Option<Result<T>>    cached = serveHit(lookup, hit);
+
+      if (cached)
+        recordStats(lookup.key, [](CacheKeyStats& stats) { ++stats.diskHits; });
+
+      return cached;
+    }
+
+    /**
+     * @brief The rest of a lookup after a memory miss: under the key lock,
+     * re-check memory, then disk, and finally run the fetcher.
+     */
+    template <typename T>
+    fn resolve(const Lookup<T>& lookup) -> Result<T> {
+      // Only one caller per key gets past this point at a time.
+      const KeyLock keyLock(*this, lookup.key);
+
+      // Another caller may have populated the entry while we were waiting.
+      if (Option<Result<T>> cached = lookupMemory(lookup))
+        return std::move(*cached);
+
+      // 2. Check filesystem cache
+      if (Option<Result<T>> cached = lookupDisk(lookup))
+        return std::move(*cached);
+
+      // 3. Cache miss: call fetcher without holding the manager mutex
+      Result<T> fetchedResult = timedFetch<T>(lookup.key, lookup.fetcher, false);
+
+      if (!fetchedResult && !(lookup.policy.negativeTtl && isRememberable(fetchedResult.error().code)))
+        return fetchedResult;
+
+      // 4. Store in cache
+      store<T>(lookup.key, lookup.policy, fetchedResult, lookup.stamps);
+
+      return fetchedResult;
+    }
+
+    template <usize... Is, typename... Ts>
+    fn resolveMany(std::index_sequence<Is...> /*indices*/, const CacheRequest<Ts>&... requests) -> Tuple<Result<Ts>...> {
+      const WriteBatch batch(*this);
+
+      // Every validator is stamped before any request is fetched.
+      const Tuple<Lookup<Ts>...> lookups { makeLookup(requests.key, requests.policy, requests.validator, requests.fetcher)... };
+
+      // 1. One pass over memory and disk for every key.
+      Tuple<Option<Result<Ts>>...> results;
+
+      const auto peek = [&]<usize I>(std::integral_constant<usize, I> /*index*/) {
+        auto& lookup = std::get<I>(lookups);
+
+        if (auto cached = lookupMemory(lookup))
+          std::get<I>(results) = std::move(cached);
+        else
+          std::get<I>(results) = lookupDisk(lookup);
+      };
+
+      (peek(std::integral_constant<usize, Is> {}), ...);
+
+      // 2. Fetch the misses concurrently. A lone miss just runs here.
+      const usize missCount = (static_cast<usize>(!std::get<Is>(results).has_value()) + ... + 0);
+
+      Vec<Future<Unit>> tasks;
+
+      const auto fetchMiss = [&]<usize I>(std::integral_constant<usize, I> /*index*/) {
+        if (std::get<I>(results))
+          return;
+
+        const auto task = [&] { std::get<I>(results) = resolve(std::get<I>(lookups)); };
+
+        if (missCount == 1) {
+          task();
+          return;
+        }
+
+        try {
+          tasks.emplace_back(std::async(std::launch::async, task));
+        } catch (const std::system_error& err) {
+          debug_log("Failed to start fetch for '{}': {}", std::get<I>(lookups).key, err.what());
+          task();
+        }
+      };
+
+      (fetchMiss(std::integral_constant<usize, Is> {}), ...);
+
+      // Wait for all of them before get() can rethrow, since the tasks reference this frame.
+      for (const Future<Unit>& task : tasks)
+        task.wait();
+
+      for (Future<Unit>& task : tasks)
+        task.get();
+
+      return Tuple<Result<Ts>...> { std::move(*std::get<Is>(results))... };
+    }
+
+    /**
+     * @brief Applies @p update to the counters for @p key under m_statsMutex.
+     */
+    template <typename Update>
+    fn recordStats(const String& key, Update&& update) -> Unit {
+      LockGuard lock(m_statsMutex);
+      std::forward<Update>(update)(m_stats[key]);
+    }
+
+    /**
+     * @brief Runs @p fetcher and records the run as a miss (or a refresh if @p background) for @p key.
+     */
+    template <typename T>
+    fn timedFetch(const String& key, const Fn<Result<T>()>& fetcher, const bool background) -> Result<T> {
+      const steady_clock::time_point begin = steady_clock::now();
+
+      Result<T> result = fetcher();
+
+      const steady_clock::duration elapsed = steady_clock::now() - begin;
+
+      recordStats(key, [&](CacheKeyStats& stats) {
+        ++(background ? stats.refreshes : stats.misses);
+
+        if (!result)
+          ++stats.fetchFailures;
+
+        stats.fetchNs += static_cast<u64>(duration_cast<nanoseconds>(elapsed).count());
+
+        usize bucket = 0;
+
+        while (bucket < CacheKeyStats::FETCH_LATENCY_BOUNDS.size() && elapsed > CacheKeyStats::FETCH_LATENCY_BOUNDS.at(bucket))
+          ++bucket;
+
+        ++stats.fetchLatency.at(bucket);
+      });
+
+      return result;
+    }
+
+    static fn classify(const system_clock::time_point expiry, const CachePolicy& policy) -> Freshness {
+      if (expiry == system_clock::time_point::max())
+        return Freshness::Fresh;
+
+      const system_clock::time_point now = system_clock::now();
+
+      if (now < expiry)
+        return policy.refreshAhead && expiry - now <= *policy.refreshAhead ? Freshness::NeedsRefresh : Freshness::Fresh;
+
+      if (policy.staleWhileRevalidate && now - expiry <= *policy.staleWhileRevalidate)
+        return Freshness::NeedsRefresh;
+
+      return Freshness::Expired;
+    }
+
+    /**
+     * @brief Whether a failure with this code may be kept under CachePolicy::negativeTtl.
+     * @details Only errors that say something is absent are stable enough to
+     * repeat; transient ones (timeouts, I/O and network errors) are always retried.
+     */
+    static fn isRememberable(const DracErrorCode code) -> bool {
+      return code == DracErrorCode::NotFound || code == DracErrorCode::NotSupported || code == DracErrorCode::ApiUnavailable;
+    }
+
+    static fn toError(const CachedError& cached) -> Err<DracError> {
+      return Err(DracError(static_cast<DracErrorCode>(cached.code), cached.message));
+    }
+
+    /**
+     * @brief Stores a freshly fetched result in memory and, unless the policy is in-memory only, on disk.
+     * @details Values use CachePolicy::ttl and failures CachePolicy::negativeTtl.
+     */
+    template <typename T>
+    fn store(const String& key, const CachePolicy& policy, const Result<T>& result, const Vec<SourceStamp>& sources) -> Unit {
+      const Option<seconds> ttl = result ? policy.ttl : policy.negativeTtl;
+
+      if (ttl && *ttl <= seconds(0))
+        return;
+
+      Option<u64> expiryTs;
+      if (ttl.has_value()) {
+        system_clock::time_point now        = system_clock::now();
+        system_clock::time_point expiryTime = now + *ttl;
+
+        expiryTs = duration_cast<seconds>(expiryTime.time_since_epoch()).count();
+      }
+
+      system_clock::time_point inMemoryExpiryTp = expiryTs.has_value()
+        ? system_clock::time_point(seconds(*expiryTs))
+        : system_clock::time_point::max();
+
+      storeInMemory<T>(key, policy, result, inMemoryExpiryTp, sources);
+
+      // Serialization is only needed for the on-disk copy.
+      if (policy.location != CacheLocation::InMemory) {
+        const CacheEntry<T> newEntry {
+          .data    = result ? *result : T {},
+          .expires = expiryTs,
+          .sources = sources,
+          .error   = result ? None : Option<CachedError>(CachedError { .code = static_cast<u8>(result.error().code), .message = result.error().message }),
+        };
+
+        writeToDisk(key, policy, encodeEntry(newEntry));
+      }
+    }
+
+    /**
+     * @brief Re-runs @p fetcher for @p key on a background thread, unless a refresh is already pending.
+     * @note On failure the existing entry is left in place, so callers keep
+     * getting the stale value until the stale-while-revalidate window closes.
+     */
+    template <typename T>
+    fn scheduleRefresh(const String& key, const CachePolicy& policy, const CacheValidator& validator, Fn<Result<T>()> fetcher) -> Unit {
+      LockGuard lock(m_cacheMutex);
+
+      if (!m_refreshing.insert(key).second)
+        return;
+
+      // Drop handles of refreshes that have already finished.
+      std::erase_if(m_refreshTasks, [](const Future<Unit>& task) {
+        return task.wait_for(seconds(0)) == std::future_status::ready;
+      });
+
+      try {
+        m_refreshTasks.emplace_back(std::async(std::launch::async, [this, key, policy, validator, fetcher = std::move(fetcher)]() -> Unit {
+          {
+            const KeyLock keyLock(*this, key);
+
+            const Vec<SourceStamp> stamps = stampSources(policy, validator);
+
+            if (Result<T> result = timedFetch<T>(key, fetcher, true))
+              store<T>(key, policy, result, stamps);
+            else
+              debug_at(result.error());
+          }
+
+          LockGuard refreshLock(m_cacheMutex);
+          m_refreshing.erase(key);
+        }));
+      } catch (const std::system_error& err) {
+        // Couldn't start a thread; the next lookup will try again.
+        debug_log("Failed to start background refresh for '{}': {}", key, err.what());
+        m_refreshing.erase(key);
+      }
+    }
+
+    /**
+     * @brief Looks up an in-memory entry of type @p T, expired or not.
+     * @note Takes m_cacheMutex only long enough to copy the shared pointer; the
+     * value itself is copied out after the lock is released. Callers decide
+     * what to do with expired entries via classify().
+     */
+    template <typename T>
+    fn readFromMemory(const String& key) -> Option<MemoryHit<T>> {
+      SharedPointer<const void> value;
+      system_clock::time_point  expiry;
+      Vec<SourceStamp>          sources;
+      Option<CachedError>       error;
+
+      {
+        LockGuard lock(m_cacheMutex);
+
+        const auto iter = m_inMemoryCache.find(key);
+
+        if (iter == m_inMemoryCache.end() || iter->second.type != typeid(T))
+          return None;
+
+        m_lru.splice(m_lru.begin(), m_lru, iter->second.lruPos);
+
+        value   = iter->second.value;
+        expiry  = iter->second.expiry;
+        sources = iter->second.sources;
+        error   = iter->second.error;
+      }
+
+      if (error)
+        return MemoryHit<T> { .value = toError(*error), .expiry = expiry, .sources = std::move(sources) };
+
+      return MemoryHit<T> { .value = *static_cast<const T*>(value.get()), .expiry = expiry, .sources = std::move(sources) };
+    }
+
+    template <typename T>
+    fn storeInMemory(
+      const String&                  key,
+      const CachePolicy&             policy,
+      const Result<T>&               result,
+      const system_clock::time_point expiry,
+      Vec<SourceStamp>               sources
+    ) -> Unit {
+      // Failures are never served stale, so only values get the stale-while-revalidate window.
+      const bool canServeStale = result && policy.staleWhileRevalidate && expiry != system_clock::time_point::max();
+
+      MemoryEntry entry {
+        .type        = typeid(T),
+        .expiry      = expiry,
+        .retainUntil = canServeStale ? expiry + *policy.staleWhileRevalidate : expiry,
+        .sources     = std::move(sources),
+      };
+
+      entry.bytes = sizeof(MemoryEntry) + key.size() + (entry.sources.size() * sizeof(SourceStamp));
+
+      if (result) {
+        entry.value = std::make_shared<const T>(*result);
+        entry.bytes += approximateSize(*result);
+      } else {
+        entry.error = CachedError { .code = static_cast<u8>(result.error().code), .message = result.error().message };
+        entry.bytes += entry.error->message.size();
+      }
+
+      Vec<String> evicted;
+
+      {
+        LockGuard lock(m_cacheMutex);
+
+        if (const system_clock::time_point now = system_clock::now(); now >= m_nextPurge) {
+          purgeExpiredLocked(now);
+          m_nextPurge = now + PURGE_INTERVAL;
+        }
+
+        insertLocked(key, std::move(entry));
+        evicted = enforceBudgetLocked(key);
+      }
+
+      recordEvictions(evicted);
+    }
+
+    /**
+     * @brief Inserts or replaces the in-memory entry for @p key and marks it most recently used.
+     */
+    fn insertLocked(const String& key, MemoryEntry entry) -> Unit {
+      const auto [iter, inserted] = m_inMemoryCache.try_emplace(key);
+
+      if (inserted) {
+        m_lru.push_front(key);
+        entry.lruPos = m_lru.begin();
+      } else {
+        m_memoryBytes -= iter->second.bytes;
+        m_lru.splice(m_lru.begin(), m_lru, iter->second.lruPos);
+        entry.lruPos = iter->second.lruPos;
+      }
+
+      m_memoryBytes += entry.bytes;
+      iter->second = std::move(entry);
+    }
+
+    fn eraseFromMemoryLocked(const UnorderedMap<String, MemoryEntry>::iterator iter) -> UnorderedMap<String, MemoryEntry>::iterator {
+      m_memoryBytes -= iter->second.bytes;
+      m_lru.erase(iter->second.lruPos);
+      return m_inMemoryCache.erase(iter);
+    }
+
+    fn purgeExpiredLocked(const system_clock::time_point now) -> usize {
+      usize removed = 0;
+
+      for (auto iter = m_inMemoryCache.begin(); iter != m_inMemoryCache.end();)
+        if (iter->second.retainUntil <= now) {
+          iter = eraseFromMemoryLocked(iter);
+          ++removed;
+        } else
+          ++iter;
+
+      return removed;
+    }
+
+    /**
+     * @brief Evicts entries until the in-memory tier fits m_memoryBudget.
+     * @param keep Key that must stay even if it is the only entry left (the one just stored).
+     * @return The evicted keys, for recordEvictions() once m_cacheMutex is released.
+     */
+    fn enforceBudgetLocked(const Option<StringView> keep) -> Vec<String> {
+      const auto overBudget = [this] {
+        return (m_memoryBudget.maxEntries != 0 && m_inMemoryCache.size() > m_memoryBudget.maxEntries) ||
+          (m_memoryBudget.maxBytes != 0 && m_memoryBytes > m_memoryBudget.maxBytes);
+      };
+
+      Vec<String> evicted;
+
+      if (!overBudget())
+        return evicted;
+
+      // Entries that can't be served anyway go first, and don't count as evictions.
+      purgeExpiredLocked(system_clock::now());
+
+      while (overBudget() && !m_lru.empty() && (!keep || m_lru.back() != *keep)) {
+        evicted.push_back(m_lru.back());
+        eraseFromMemoryLocked(m_inMemoryCache.find(evicted.back()));
+      }
+
+      return evicted;
+    }
+
+    fn recordEvictions(const Vec<String>& keys) -> Unit {
+      for (const String& key : keys)
+        recordStats(key, [](CacheKeyStats& stats) { ++stats.evictions; });
+    }
+
+    /**
+     * @brief Fixed header of a raw (non-BEVE) on-disk entry. See encodeEntry().
+     */
+    struct RawEntryHeader {
+      Array<char, 4> magic;       ///< RAW_ENTRY_MAGIC.
+      u32            fingerprint; ///< rawTypeFingerprint<T>().
+      u32            valueSize;   ///< sizeof(T).
+      u16            sourceCount; ///< Number of RawSourceHeader records after the value.
+      u8             flags;       ///< RAW_HAS_EXPIRY | RAW_HAS_ERROR.
+      u8             errorCode;   ///< DracErrorCode if RAW_HAS_ERROR is set.
+      u64            expires;     ///< UNIX timestamp if RAW_HAS_EXPIRY is set.
+    };
+
+    /**
+     * @brief Fixed part of a SourceStamp in a raw entry, followed by pathSize bytes of path.
+     */
+    struct RawSourceHeader {
+      i64 mtimeNs;
+      u64 inode;
+      u64 size;
+      u64 pathSize;
+    };
+
+    // A BEVE-encoded CacheEntry always starts with an object tag, which is never zero.
+    static constexpr Array<char, 4> RAW_ENTRY_MAGIC = { '\0', 'D', 'R', 'W' };
+
+    static constexpr u8 RAW_HAS_EXPIRY = 1U << 0U;
+    static constexpr u8 RAW_HAS_ERROR  = 1U << 1U;
+
+    /**
+     * @brief FNV-1a hash of @p T's name as the compiler spells it, its size, alignment and RawCacheLayout version,
+     * so a raw entry written for one type (or an older layout of it) is never read as another.
+     */
+    template <typename T>
+    static consteval fn rawTypeFingerprint() -> u32 {
+      u32 hash = 2166136261U;
+
+      const auto mix = [&hash](const u8 byte) {
+        hash ^= byte;
+        hash *= 16777619U;
+      };
+
+      for (const char chr : StringView(std::source_location::current().function_name()))
+        mix(static_cast<u8>(chr));
+
+      for (const u64 value : { u64 { sizeof(T) }, u64 { alignof(T) }, u64 { RawCacheLayout<T>::version } })
+        for (usize shift = 0; shift < 64; shift += 8)
+          mix(static_cast<u8>(value >> shift));
+
+      return hash;
+    }
+
+    /**
+     * @brief Serializes @p entry for the on-disk tiers.
+     *
+     * Types opted in through RawCacheLayout skip BEVE: the entry is written
+     * as a RawEntryHeader, the bytes of the value, an optional length-prefixed
+     * error message and the source stamps. Reading one back is a few memcpys
+     * and a size/fingerprint check. Everything else is written as BEVE.
+     */
+    template <typename T>
+    static fn encodeEntry(const CacheEntry<T>& entry) -> String {
+      String buffer;
+
+      if constexpr (RawCacheLayout<T>::enabled) {
+        static_assert(std::is_trivially_copyable_v<T>, "RawCacheLayout is only for trivially copyable types");
+
+        const RawEntryHeader header {
+          .magic       = RAW_ENTRY_MAGIC,
+          .fingerprint = rawTypeFingerprint<T>(),
+          .valueSize   = sizeof(T),
+          .sourceCount = static_cast<u16>(entry.sources.size()),
+          .flags       = static_cast<u8>((entry.expires ? RAW_HAS_EXPIRY : 0U) | (entry.error ? RAW_HAS_ERROR : 0U)),
+          .errorCode   = entry.error ? entry.error->code : u8 { 0 },
+          .expires     = entry.expires.value_or(0),
+        };
+
+        const auto appendBytes = [&buffer](const void* data, const usize size) {
+          buffer.append(static_cast<const char*>(data), size);
+        };
+
+        appendBytes(&header, sizeof(header));
+        appendBytes(&entry.data, sizeof(T));
+
+        if (entry.error) {
+          const u64 messageSize = entry.error->message.size();
+          appendBytes(&messageSize, sizeof(messageSize));
+          buffer.append(entry.error->message);
+        }
+
+        for (const SourceStamp& stamp : entry.sources) {
+          const RawSourceHeader source { .mtimeNs = stamp.mtimeNs, .inode = stamp.inode, .size = stamp.size, .pathSize = stamp.path.size() };
+          appendBytes(&source, sizeof(source));
+          buffer.append(stamp.path);
+        }
+      } else
+        glz::write_beve(entry, buffer);
+
+      return buffer;
+    }
+
+    /**
+     * @brief Parses an entry written by encodeEntry() into @p entry.
+     * @return false if @p bytes are truncated, corrupt, or were written for a different type.
+     */
+    template <typename T>
+    static fn decodeEntry(const StringView bytes, CacheEntry<T>& entry) -> bool {
+      if constexpr (RawCacheLayout<T>::enabled) {
+        usize offset = 0;
+
+        const auto readBytes = [&bytes, &offset](void* out, const usize size) -> bool {
+          if (bytes.size() - offset < size)
+            return false;
+
+          std::memcpy(out, bytes.data() + offset, size);
+          offset += size;
+          return true;
+        };
+
+        const auto readString = [&bytes, &offset](String& out, const u64 size) -> bool {
+          if (bytes.size() - offset < size)
+            return false;
+
+          out.assign(bytes.substr(offset, size));
+          offset += size;
+          return true;
+        };
+
+        RawEntryHeader header {};
+
+        if (!readBytes(&header, sizeof(header)) || header.magic != RAW_ENTRY_MAGIC ||
+            header.fingerprint != rawTypeFingerprint<T>() || header.valueSize != sizeof(T))
+          return false;
+
+        if (!readBytes(&entry.data, sizeof(T)))
+          return false;
+
+        entry.expires = header.flags & RAW_HAS_EXPIRY ? Option<u64>(header.expires) : None;
+
+        if (header.flags & RAW_HAS_ERROR) {
+          u64 messageSize = 0;
+
+          if (!readBytes(&messageSize, sizeof(messageSize)))
+            return false;
+
+          entry.error = CachedError { .code = header.errorCode, .message = {} };
+
+          if (!readString(entry.error->message, messageSize))
+            return false;
+        }
+
+        entry.sources.resize(header.sourceCount);
+
+        for (SourceStamp& stamp : entry.sources) {
+          RawSourceHeader source {};
+
+          if (!readBytes(&source, sizeof(source)) || !readString(stamp.path, source.pathSize))
+            return false;
+
+          stamp.mtimeNs = source.mtimeNs;
+          stamp.inode   = source.inode;
+          stamp.size    = source.size;
+        }
+
+        return offset == bytes.size();
+      } else
+        return glz::read_beve(entry, bytes) == glz::error_code::none;
+    }
+
+    /**
+     * @brief Rough size of @p value including the heap memory of strings, optionals and containers.
+     */
+    template <typename T>
+    static fn approximateSize(const T& value) -> usize {
+      if constexpr (std::is_same_v<T, String>)
+        return sizeof(T) + value.capacity();
+      else if constexpr (requires { value.has_value(); *value; })
+        return sizeof(T) + (value ? approximateSize(*value) - sizeof(*value) : 0);
+      else if constexpr (requires { value.begin(); value.end(); }) {
+        usize total = sizeof(T);
+
+        for (const auto& element : value)
+          total += approximateSize(element);
+
+        return total;
+      } else
+        return sizeof(T);
+    }
+
+    /**
+     * @brief Stamps @p validator's sources, plus the current boot if @p policy is boot-scoped.
+     */
+    static fn stampSources(const CachePolicy& policy, const CacheValidator& validator) -> Vec<SourceStamp> {
+      Vec<SourceStamp> stamps;
+      stamps.reserve(validator.sources.size() + 1);
+
+      if (policy.bootScoped)
+        stamps.push_back(bootStamp());
+
+      for (const fs::path& source : validator.sources) {
+        SourceStamp& stamp = stamps.emplace_back(SourceStamp { .path = source.string() });
+
+#ifdef _WIN32
+        // No inode on Windows; mtime and size have to do.
+        std::error_code errc;
+
+        if (const fs::file_time_type mtime = fs::last_write_time(source, errc); !errc) {
+          stamp.mtimeNs = duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count();
+          stamp.size    = fs::is_regular_file(source, errc) ? fs::file_size(source, errc) : 0;
+        }
+#else
+        if (struct stat info {}; ::stat(source.c_str(), &info) == 0) {
+  #ifdef __APPLE__
+          const timespec& mtime = info.st_mtimespec;
+  #else
+          const timespec& mtime = info.st_mtim;
+  #endif
+
+          stamp.mtimeNs = (static_cast<i64>(mtime.tv_sec) * 1'000'000'000) + mtime.tv_nsec;
+          stamp.inode   = static_cast<u64>(info.st_ino);
+          stamp.size    = static_cast<u64>(info.st_size);
+        }
+#endif
+      }
+
+      return stamps;
+    }
+
+    /**
+     * @brief The stamp that ties a boot-scoped entry to the current boot.
+     */
+    static fn bootStamp() -> SourceStamp {
+      if (const Option<String>& bootId = getBootId())
+        return { .path = std::format("boot:{}", *bootId) };
+
+      // No boot identifier, so fall back to something that only matches within this process.
+      static const i64 PROCESS_START = system_clock::now().time_since_epoch().count();
+
+      return { .path = "boot:unknown", .mtimeNs = PROCESS_START };
+    }
+
+    static fn getStoreIndex(const CacheLocation location) -> usize {
+      return location == CacheLocation::TempDirectory ? 0 : 1;
+    }
+
+    static fn getPersistentCacheDir() -> fs::path {
+#ifdef __APPLE__
+      return std::format("{}/Library/Caches/draconis++", draconis::utils::env::GetEnv("HOME").value_or("."));
+#else
+      return std::format("{}/.cache/draconis++", draconis::utils::env::GetEnv("HOME").value_or("."));
+#endif
+    }
+
+    static fn getStoreFilePath(const CacheLocation location) -> fs::path {
+      if (location == CacheLocation::TempDirectory)
+        return getTempCacheDir() / "draconis++.cache";
+
+      return getPersistentCacheDir() / "draconis++.cache";
+    }
+
+    /**
+     * @brief Returns the mapped store for @p location, opening it on first use.
+     * @return nullptr if the store file could not be opened.
+     */
+    fn getStore(const CacheLocation location) -> SharedPointer<CacheStore> {
+      LockGuard lock(m_storeMutex);
+
+      SharedPointer<CacheStore>& store = m_stores.at(getStoreIndex(location));
+
+      if (!store) {
+        if (location == CacheLocation::TempDirectory && !tempDirUsableLocked())
+          return nullptr;
+
+        Result<UniquePointer<CacheStore>> opened = CacheStore::open(getStoreFilePath(location));
+
+        if (!opened) {
+          debug_at(opened.error());
+          return nullptr;
+        }
+
+        store = std::move(*opened);
+      }
+
+      return store;
+    }
+
+    /**
+     * @brief Reads the serialized entry for @p key from the location/storage named by @p policy.
+     */
+    fn readFromDisk(const String& key, const CachePolicy& policy) -> Option<String> {
+      if (policy.location == CacheLocation::InMemory)
+        return None;
+
+      if (policy.storage == CacheStorage::MappedFile)
+        if (const SharedPointer<CacheStore> store = getStore(policy.location))
+          return store->get(key);
+
+      const Option<fs::path> filePath = getCacheFilePath(key, policy.location);
+
+      if (!filePath || !fs::exists(*filePath))
+        return None;
+
+      std::ifstream ifs(*filePath, std::ios::binary);
+
+      if (!ifs)
+        return None;
+
+      return String((std::istreambuf_iterator<char>(ifs)), {});
+    }
+
+    /**
+     * @brief Writes a serialized entry for @p key to the location/storage named by @p policy.
+     * @note Queued instead if a WriteBatch is active.
+     */
+    fn writeToDisk(const String& key, const CachePolicy& policy, String bytes) -> Unit {
+      Vec<PendingWrite> writes;
+      writes.push_back({ .key = key, .location = policy.location, .storage = policy.storage, .bytes = std::move(bytes) });
+
+      {
+        LockGuard lock(m_batchMutex);
+
+        if (m_batchDepth > 0) {
+          m_pendingWrites.push_back(std::move(writes.front()));
+          return;
+        }
+      }
+
+      flushWrites(writes);
+    }
+
+    fn endBatch() -> Unit {
+      Vec<PendingWrite> writes;
+
+      {
+        LockGuard lock(m_batchMutex);
+
+        if (--m_batchDepth > 0)
+          return;
+
+        writes.swap(m_pendingWrites);
+      }
+
+      flushWrites(writes);
+    }
+
+    /**
+     * @brief Writes @p writes out, with one CacheStore::putMany() per mapped store.
+     * @note Falls back to per-key files if a mapped store cannot be opened.
+     */
+    fn flushWrites(const Vec<PendingWrite>& writes) -> Unit {
+      for (const CacheLocation location : { CacheLocation::TempDirectory, CacheLocation::Persistent }) {
+        Vec<const PendingWrite*> mapped;
+
+        for (const PendingWrite& write : writes)
+          if (write.location == location && write.storage == CacheStorage::MappedFile)
+            mapped.push_back(&write);
+
+        if (mapped.empty())
+          continue;
+
+        const SharedPointer<CacheStore> store = getStore(location);
+
+        if (!store) {
+          for (const PendingWrite* write : mapped)
+            writeFile(*write);
+
+          continue;
+        }
+
+        Vec<Pair<StringView, StringView>> records;
+        records.reserve(mapped.size());
+
+        for (const PendingWrite* write : mapped)
+          records.emplace_back(write->key, write->bytes);
+
+        if (Result<> res = store->putMany(records); !res) {
+          debug_at(res.error());
+          continue;
+        }
+
+        for (const PendingWrite* write : mapped)
+          recordStats(write->key, [&](CacheKeyStats& stats) { stats.bytesWritten += write->bytes.size(); });
+      }
+
+      for (const PendingWrite& write : writes)
+        if (write.storage == CacheStorage::PerKeyFiles)
+          writeFile(write);
+    }
+
+    /**
+     * @brief Writes one entry to its own file (CacheStorage::PerKeyFiles).
+     */
+    fn writeFile(const PendingWrite& write) -> Unit {
+      const Option<fs::path> filePath = getCacheFilePath(write.key, write.location);
+
+      if (!filePath)
+        return;
+
+      std::error_code errc;
+      fs::create_directories(filePath->parent_path(), errc);
+
+      std::ofstream ofs(*filePath, std::ios::binary | std::ios::trunc);
+      ofs.write(write.bytes.data(), static_cast<std::streamsize>(write.bytes.size()));
+
+      if (!ofs)
+        return;
+
+      recordStats(write.key, [&](CacheKeyStats& stats) { stats.bytesWritten += write.bytes.size(); });
+
+      if (write.location == CacheLocation::TempDirectory)
+        addToManifest(write.key);
+    }
+
+    static fn getManifestPath() -> fs::path {
+      return getTempCacheDir() / "draconis++.manifest";
+    }
+
+    /**
+     * @brief Creates getTempCacheDir() on first use and checks that it belongs to us.
+     * @note Expects m_storeMutex to be held.
+     */
+    fn tempDirUsableLocked() -> bool {
+      if (m_tempDirUsable)
+        return *m_tempDirUsable;
+
+      const fs::path dir = getTempCacheDir();
+
+      std::error_code errc;
+      fs::create_directories(dir, errc);
+
+#ifndef _WIN32
+      // Anyone can create this path before us, so refuse to use it unless it's
+      // a real directory that we own, and keep other users out of it.
+      struct stat info {};
+
+      if (lstat(dir.c_str(), &info) != 0 || !S_ISDIR(info.st_mode) || info.st_uid != getuid()) {
+        debug_log("Not using temp cache directory '{}': not a directory owned by us", dir.string());
+        m_tempDirUsable = false;
+        return false;
+      }
+
+      fs::permissions(dir, fs::perms::owner_all, fs::perm_options::replace, errc);
+#endif
+
+      m_tempDirUsable = fs::is_directory(dir, errc);
+      return *m_tempDirUsable;
+    }
+
+    /**
+     * @brief Reads the manifest into m_manifestKeys the first time it's needed.
+     * @note Expects m_storeMutex to be held.
+     */
+    fn loadManifestLocked() -> Unit {
+      if (m_manifestLoaded)
+        return;
+
+      m_manifestLoaded = true;
+
+      std::ifstream ifs(getManifestPath());
+
+      for (String line; std::getline(ifs, line);)
+        if (!line.empty())
+          m_manifestKeys.insert(std::move(line));
+    }
+
+    /**
+     * @brief Records that a per-key file for @p key exists in the temp directory.
+     *
+     * The manifest is append-only and may list keys whose files are already
+     * gone; invalidateAll() only needs it to be a superset of what's there.
+     */
+    fn addToManifest(const String& key) -> Unit {
+      LockGuard lock(m_storeMutex);
+
+      loadManifestLocked();
+
+      if (!m_manifestKeys.insert(key).second)
+        return;
+
+      std::ofstream ofs(getManifestPath(), std::ios::app);
+      ofs << key << '\n';
+    }
+
+    fn getCacheFilePath(const String& key, const CacheLocation location) -> Option<fs::path> {
+      using matchit::match, matchit::is, matchit::_;
+
+      Option<fs::path> cacheDir = None;
+
+      if (location == CacheLocation::InMemory)
+        return None; // In-memory cache does not have a file path
+
+      if (location == CacheLocation::TempDirectory) {
+        LockGuard lock(m_storeMutex);
+
+        if (!tempDirUsableLocked())
+          return None;
+
+        return Some(getTempCacheDir() / key);
+      }
+
+      if (location == CacheLocation::Persistent)
+        return Some(getPersistentCacheDir() / key);
+
+      if (cacheDir) {
+        fs::create_directories(*cacheDir);
+        return *cacheDir / key;
+      }
+
+      return None;
+    }
+  };
+} // namespace draconis::utils::cache
+
+namespace glz {
+  template <>
+  struct meta<draconis::utils::types::OSInfo> {
+    using T = draconis::utils::types::OSInfo;
+
+    // clang-format off
+    static constexpr detail::Object value = object(
+      "name", &T::name,
+      "version", &T::version,
+      "id", &T::id
+    );
+    // clang-format on
+  };
+
+  template <>
+  struct meta<draconis::utils::types::CPUCores> {
+    using T = draconis::utils::types::CPUCores;
+
+    static constexpr detail::Object value = object("physical", &T::physical, "logical", &T::logical);
+  };
+
+  template <>
+  struct meta<draconis::utils::types::NetworkInterface> {
+    using T = draconis::utils::types::NetworkInterface;
+
+    // clang-format off
+    static constexpr detail::Object value = object(
+      "name",          &T::name,
+      "isUp",          &T::isUp,
+      "isLoopback",    &T::isLoopback,
+      "isRunning",     &T::isRunning,
+      "ipv4Address",   &T::ipv4Address,
+      "ipv6Address",   &T::ipv6Address,
+      "ipv4Addresses", &T::ipv4Addresses,
+      "ipv6Addresses", &T::ipv6Addresses,
+      "macAddress",    &T::macAddress,
+      "mtu",           &T::mtu
+    );
+    // clang-format on
+  };
+
+  template <>
   struct meta<draconis::utils::types::DisplayInfo> {
     using T = draconis::utils::types::DisplayInfo;
 
@@ -378,6 +1866,55 @@ namespace glz {
   struct meta<draconis::utils::cache::CacheManager::CacheEntry<Tp>> {
     using T = draconis::utils::cache::CacheManager::CacheEntry<Tp>;
 
-    static constexpr detail::Object value = object("data", &T::data, "expires", &T::expires);
+    static constexpr detail::Object value = object("data", &T::data, "expires", &T::expires, "sources", &T::sources, "error", &T::error);
+  };
+
+  template <>
+  struct meta<draconis::utils::cache::CacheKeyStats> {
+    using T = draconis::utils::cache::CacheKeyStats;
+
+    // clang-format off
+    static constexpr detail::Object value = object(
+      "memoryHits",     &T::memoryHits,
+      "diskHits",       &T::diskHits,
+      "misses",         &T::misses,
+      "fetchFailures",  &T::fetchFailures,
+      "refreshes",      &T::refreshes,
+      "decodeFailures", &T::decodeFailures,
+      "bytesRead",      &T::bytesRead,
+      "bytesWritten",   &T::bytesWritten,
+      "fetchNs",        &T::fetchNs,
+      "evictions",      &T::evictions,
+      "fetchLatency",   &T::fetchLatency
+    );
+    // clang-format on
+  };
+
+  template <>
+  struct meta<draconis::utils::cache::CachedError> {
+    using T = draconis::utils::cache::CachedError;
+
+    static constexpr detail::Object value = object("code", &T::code, "message", &T::message);
+  };
+
+  template <>
+  struct meta<draconis::utils::types::MediaInfo> {
+    using T = draconis::utils::types::MediaInfo;
+
+    static constexpr detail::Object value = object("title", &T::title, "artist", &T::artist);
+  };
+
+  template <>
+  struct meta<draconis::utils::cache::SourceStamp> {
+    using T = draconis::utils::cache::SourceStamp;
+
+    // clang-format off
+    static constexpr detail::Object value = object(
+      "path",    &T::path,
+      "mtimeNs", &T::mtimeNs,
+      "inode",   &T::inode,
+      "size",    &T::size
+    );
+    // clang-format on
   };
 } // namespace glz
@@ -0,0 +1,160 @@
+/**
+ * @file CacheStore.hpp
+ * @brief Single-file, memory-mapped key/value store used by the on-disk cache tiers.
+ *
+ * All entries for a cache location live in one file. The file is mapped once
+ * when the store is opened and an index of key -> (offset, size) is built from
+ * it, so a lookup is a hash-map probe plus a copy out of the mapping instead of
+ * an `fs::exists` + `ifstream` per key.
+ *
+ * File layout:
+ * @code
+ *   FileHeader  { magic "DRACST01", version, reserved, end }
+ *   Record      { keySize, valueSize, flags, reserved } key bytes, value bytes
+ *   Record      ...
+ * @endcode
+ *
+ * Records are only ever appended. A newer record for the same key supersedes
+ * the older one, and a record with the tombstone flag removes the key. The
+ * header's `end` field is updated after each append, so a torn write is simply
+ * ignored on the next open. Once superseded records outweigh live ones, the
+ * file is rewritten with only the live records and atomically renamed over the
+ * original.
+ *
+ * On POSIX systems appends and compaction are serialised between processes
+ * with `flock`, and a lookup that misses re-reads the header to pick up
+ * records appended by other processes. On Windows the file is read into memory instead of mapped and
+ * no cross-process locking is done.
+ */
+
+#pragma once
+
+#include <filesystem>
+
+#include "Error.hpp"
+#include "Types.hpp"
+
+namespace draconis::utils::cache {
+  namespace {
+    using types::i32;
+    using types::Mutex;
+    using types::Option;
+    using types::Pair;
+    using types::Result;
+    using types::Span;
+    using types::String;
+    using types::StringView;
+    using types::u32;
+    using types::u64;
+    using types::UniquePointer;
+    using types::Unit;
+    using types::UnorderedMap;
+    using types::usize;
+
+    namespace fs = std::filesystem;
+  } // namespace
+
+  class CacheStore {
+   public:
+    /**
+     * @brief Opens (creating if needed) the store at @p path.
+     * @param path File backing the store. Parent directories are created.
+     * @return The opened store, or an IoError/CorruptedData error.
+     */
+    static fn open(const fs::path& path) -> Result<UniquePointer<CacheStore>>;
+
+    ~CacheStore();
+
+    CacheStore(const CacheStore&)                = delete;
+    CacheStore(CacheStore&&)                     = delete;
+    fn operator=(const CacheStore&)->CacheStore& = delete;
+    fn operator=(CacheStore&&)->CacheStore&      = delete;
+
+    /**
+     * @brief Returns a copy of the value stored for @p key, if any.
+     * @details On a miss, first picks up records other processes have written since the file was last mapped.
+     */
+    fn get(StringView key) -> Option<String>;
+
+    /**
+     * @brief Appends a new value for @p key, superseding any previous one.
+     */
+    fn put(StringView key, StringView value) -> Result<>;
+
+    /**
+     * @brief Appends several key/value pairs with one file lock and one header update.
+     * @details Later pairs for the same key supersede earlier ones.
+     */
+    fn putMany(Span<const Pair<StringView, StringView>> entries) -> Result<>;
+
+    /**
+     * @brief Appends a tombstone for @p key. A no-op if the key is absent.
+     */
+    fn erase(StringView key) -> Result<>;
+
+    /**
+     * @brief Rewrites the file with only the live records.
+     * @note Called automatically from put()/putMany()/erase() once dead bytes exceed
+     * both COMPACT_MIN_DEAD_BYTES and the number of live bytes.
+     */
+    fn compact() -> Result<>;
+
+    /**
+     * @brief Path of the file backing this store.
+     */
+    [[nodiscard]] fn path() const -> const fs::path& {
+      return m_path;
+    }
+
+    static constexpr usize COMPACT_MIN_DEAD_BYTES = 64 * 1024;
+
+   private:
+    /**
+     * @brief Location of a record's value inside the mapped file.
+     */
+    struct Slot {
+      u64 offset;     ///< Offset of the value bytes from the start of the file.
+      u32 valueSize;  ///< Size of the value in bytes.
+      u32 recordSize; ///< Size of the whole record, used for dead-byte accounting.
+    };
+
+    explicit CacheStore(fs::path path);
+
+    // These expect m_mutex to be held. The *Locked helpers additionally expect
+    // the file lock to be held.
+    fn openFile() -> Result<>;
+    fn closeFile() -> Unit;
+    fn readCommittedEnd() const -> Option<u64>;
+    fn resetLocked() -> Result<>;
+    fn remap(u64 end) -> Result<>;
+    fn scan(u64 from, u64 end) -> Result<>;
+    fn refreshLocked() -> Result<>;
+    fn appendRecords(StringView records) -> Result<>;
+    fn compactLocked() -> Result<>;
+    fn replaceFile(StringView contents) -> Result<>;
+    fn isCurrentFile() const -> bool;
+    fn writeAt(u64 offset, StringView bytes) -> Result<>;
+    fn lockFile() -> Unit;
+    fn unlockFile() -> Unit;
+
+    fs::path m_path;
+
+    mutable Mutex m_mutex;
+
+    UnorderedMap<String, Slot> m_index;
+
+    StringView m_view;          ///< The committed part of the file (header included).
+    u64        m_liveBytes = 0; ///< Bytes taken up by records currently in m_index.
+    u64        m_deadBytes = 0; ///< Bytes taken up by superseded records and tombstones.
+
+#ifdef _WIN32
+    String m_buffer; ///< Whole-file copy standing in for the mapping.
+#else
+    i32   m_fd      = -1;
+    void* m_map     = nullptr;
+    usize m_mapSize = 0;
+    u64   m_device  = 0; ///< Together with m_inode, identifies the file m_fd refers to.
+    u64   m_inode   = 0;
+#endif
+  };
+} // namespace draconis::utils::cache
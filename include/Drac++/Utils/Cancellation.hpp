@@ -0,0 +1,171 @@
+/**
+ * @file Cancellation.hpp
+ * @brief Per-thread stop token and deadline that blocking readouts check while they work.
+ *
+ * Readouts are plain synchronous functions with platform-specific signatures,
+ * and most of the time they're called from inside a cache fetcher, so rather
+ * than adding a stop token parameter to every one of them, the caller opens a
+ * CancellationScope. Everything that runs on that thread until the scope ends
+ * (directory scans, sqlite queries, curl transfers, DBus calls) checks it and
+ * gives up early, returning a Cancelled or Timeout error.
+ *
+ * @code{.cpp}
+ * using namespace std::chrono_literals;
+ *
+ * {
+ *   const CancellationScope scope(std::chrono::steady_clock::now() + 200ms);
+ *
+ *   // Returns a Timeout error if the package databases take longer than 200ms.
+ *   Result<u64> count = draconis::services::packages::GetTotalCount(cache, managers);
+ * }
+ * @endcode
+ *
+ * Tasks started with Spawn() run inside a scope tied to their own stop token,
+ * so Task::cancel() reaches the readout too.
+ *
+ * @note Calls that the OS gives no way to interrupt (statvfs on a hung network
+ * filesystem, for one) are only bounded by the caller abandoning them.
+ */
+
+#pragma once
+
+#include <algorithm>  // std::{max, min}
+#include <chrono>     // std::chrono::{ceil, duration, milliseconds, steady_clock}
+#include <stop_token> // std::stop_token
+
+#include "Error.hpp"
+#include "Types.hpp"
+
+namespace draconis::utils::cancellation {
+  namespace {
+    using error::DracError;
+    using error::DracErrorCode;
+
+    using types::Err;
+    using types::None;
+    using types::Option;
+    using types::Result;
+
+    using std::chrono::milliseconds;
+  } // namespace
+
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @brief Applies a stop token and/or deadline to the current thread for as long as it exists.
+   *
+   * @details Scopes nest: code inside an inner scope is stopped by the inner
+   * scope's token or any outer one, and by whichever deadline comes first.
+   * Scopes must be destroyed in reverse order on the thread that created them,
+   * which is what happens naturally for locals.
+   */
+  class CancellationScope {
+   public:
+    explicit CancellationScope(const Option<Clock::time_point> deadline, std::stop_token token = {})
+      : m_token(std::move(token)), m_deadline(deadline), m_parent(s_current) {
+      if (m_parent && m_parent->m_deadline && (!m_deadline || *m_parent->m_deadline < *m_deadline))
+        m_deadline = m_parent->m_deadline;
+
+      s_current = this;
+    }
+
+    explicit CancellationScope(std::stop_token token)
+      : CancellationScope(None, std::move(token)) {}
+
+    ~CancellationScope() {
+      s_current = m_parent;
+    }
+
+    CancellationScope(const CancellationScope&)                = delete;
+    CancellationScope(CancellationScope&&)                     = delete;
+    fn operator=(const CancellationScope&)->CancellationScope& = delete;
+    fn operator=(CancellationScope&&)->CancellationScope&      = delete;
+
+    /**
+     * @brief The innermost scope open on this thread, or nullptr if there is none.
+     */
+    static fn current() -> const CancellationScope* {
+      return s_current;
+    }
+
+    /**
+     * @brief Whether this scope's token, or that of any scope around it, has been stopped.
+     */
+    [[nodiscard]] fn stopRequested() const -> bool {
+      for (const CancellationScope* scope = this; scope; scope = scope->m_parent)
+        if (scope->m_token.stop_requested())
+          return true;
+
+      return false;
+    }
+
+    /**
+     * @brief The earliest deadline of this scope and the ones around it.
+     */
+    [[nodiscard]] fn deadline() const -> Option<Clock::time_point> {
+      return m_deadline;
+    }
+
+   private:
+    std::stop_token           m_token;
+    Option<Clock::time_point> m_deadline;
+    const CancellationScope*  m_parent;
+
+    static inline thread_local const CancellationScope* s_current = nullptr;
+  };
+
+  /**
+   * @brief Checks the current thread's scope.
+   * @return Nothing if work may continue, otherwise a Cancelled error (stop
+   * requested) or a Timeout error (deadline passed).
+   * @note Reads the clock when a deadline is set, so in tight loops only call
+   * it every so often.
+   */
+  inline fn CheckCancelled() -> Result<> {
+    const CancellationScope* scope = CancellationScope::current();
+
+    if (!scope)
+      return {};
+
+    if (scope->stopRequested())
+      return Err(DracError(DracErrorCode::Cancelled, "Readout was cancelled"));
+
+    if (const Option<Clock::time_point> deadline = scope->deadline(); deadline && Clock::now() >= *deadline)
+      return Err(DracError(DracErrorCode::Timeout, "Readout deadline passed"));
+
+    return {};
+  }
+
+  /**
+   * @brief Whether the current thread's work should stop. See CheckCancelled().
+   */
+  inline fn StopRequested() -> bool {
+    return !CheckCancelled();
+  }
+
+  /**
+   * @brief Time left until the current thread's deadline, or None if it has none.
+   * @return Zero once the deadline has passed.
+   */
+  inline fn RemainingTime() -> Option<milliseconds> {
+    const CancellationScope* scope = CancellationScope::current();
+
+    if (!scope || !scope->deadline())
+      return None;
+
+    return std::max(std::chrono::ceil<milliseconds>(*scope->deadline() - Clock::now()), milliseconds(0));
+  }
+
+  /**
+   * @brief Shortens @p timeout so it doesn't run past the current thread's deadline.
+   */
+  template <typename Rep, typename Period>
+  fn ClampTimeout(const std::chrono::duration<Rep, Period> timeout) -> milliseconds {
+    const milliseconds requested = std::chrono::ceil<milliseconds>(timeout);
+
+    if (const Option<milliseconds> remaining = RemainingTime())
+      return std::min(requested, *remaining);
+
+    return requested;
+  }
+} // namespace draconis::utils::cancellation
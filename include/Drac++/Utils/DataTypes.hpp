@@ -103,6 +103,9 @@ namespace draconis::utils::types {
   /**
    * @struct NetworkInterface
    * @brief Represents a network interface.
+   *
+   * @note Traffic counters aren't included, since this readout is cached;
+   * services::sampling::NetworkSampler reports them live.
    */
   struct NetworkInterface {
     String         name;        ///< Network interface name.
@@ -112,6 +115,11 @@ namespace draconis::utils::types {
     bool           isUp;        ///< Whether the network interface is up.
     bool           isLoopback;  ///< Whether the network interface is a loopback interface.
 
+    bool        isRunning = false; ///< Whether the link is operational (up, with a carrier).
+    Vec<String> ipv4Addresses;     ///< Every IPv4 address, where the platform reports more than one.
+    Vec<String> ipv6Addresses;     ///< Every IPv6 address, where the platform reports more than one.
+    Option<u32> mtu;               ///< Maximum transmission unit, in bytes.
+
     NetworkInterface() = default;
 
     NetworkInterface(String& name, Option<String> ipv4Address, Option<String> ipv6Address, Option<String> macAddress, bool isUp, bool isLoopback)
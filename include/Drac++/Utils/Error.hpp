@@ -22,6 +22,7 @@ namespace draconis::utils::error {
   /**
    * @enum DracErrorCode
    * @brief Error codes for general OS-level operations.
+   * @note Negative cache entries persist these as their numeric value, so new codes go at the end.
    */
   enum class DracErrorCode : u8 {
     ApiUnavailable,     ///< A required OS service/API is unavailable or failed unexpectedly at runtime.
@@ -42,6 +43,7 @@ namespace draconis::utils::error {
     ResourceExhausted,  ///< System resource limit reached (not memory).
     Timeout,            ///< An operation timed out (e.g., waiting for IPC reply).
     UnavailableFeature, ///< Feature not present on this hardware/OS.
+    Cancelled,          ///< The operation was cancelled before it produced a result.
   };
 
   /**
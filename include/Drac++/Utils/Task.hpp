@@ -0,0 +1,232 @@
+/**
+ * @file Task.hpp
+ * @brief Handle to a Result<T>-producing job running on a ThreadPool.
+ *
+ * A Task can be waited on like a future, polled, cancelled, or `co_await`ed
+ * from a coroutine. When awaited, the coroutine is resumed on the pool thread
+ * that finished the job, so no thread is tied up waiting for it.
+ *
+ * @code{.cpp}
+ * Task<String> kernel = GetKernelVersionAsync(cache);
+ * Task<String> host   = GetHostAsync(cache);
+ *
+ * // Both are already running; this waits for whichever is slower.
+ * Result<String> kernelResult = co_await kernel;
+ * Result<String> hostResult   = co_await host;
+ * @endcode
+ */
+
+#pragma once
+
+#include <chrono>             // std::chrono::{duration, steady_clock, time_point}
+#include <condition_variable> // std::condition_variable
+#include <coroutine>          // std::coroutine_handle
+#include <exception>          // std::exception
+#include <stop_token>         // std::{stop_source, stop_token}
+#include <type_traits>        // std::{invoke_result_t, is_invocable_v, type_identity}
+
+#include "Cancellation.hpp"
+#include "Error.hpp"
+#include "ThreadPool.hpp"
+#include "Types.hpp"
+
+namespace draconis::utils::threading {
+  namespace {
+    using cancellation::CancellationScope;
+
+    using error::DracError;
+    using error::DracErrorCode;
+
+    using types::Err;
+    using types::LockGuard;
+    using types::Mutex;
+    using types::Option;
+    using types::Result;
+    using types::SharedPointer;
+    using types::Unit;
+  } // namespace
+
+  namespace detail {
+    template <typename F>
+    consteval fn JobResultOf() {
+      if constexpr (std::is_invocable_v<F, std::stop_token>)
+        return std::type_identity<std::invoke_result_t<F, std::stop_token>> {};
+      else
+        return std::type_identity<std::invoke_result_t<F>> {};
+    }
+
+    /// What a job returns, whether or not it takes a stop token.
+    template <typename F>
+    using JobResult = decltype(JobResultOf<F>())::type;
+
+    /**
+     * @brief What a Task and the job filling it share.
+     */
+    template <typename T>
+    struct TaskState {
+      Mutex                   mutex;
+      std::condition_variable done;
+      Option<Result<T>>       result;
+      std::coroutine_handle<> continuation;
+      std::stop_source        stop;
+
+      /**
+       * @brief Stores @p value unless a result is already there, then wakes whoever is waiting.
+       */
+      fn complete(Result<T> value) -> Unit {
+        std::coroutine_handle<> resume;
+
+        {
+          LockGuard lock(mutex);
+
+          if (result)
+            return;
+
+          result = std::move(value);
+          std::swap(resume, continuation);
+        }
+
+        done.notify_all();
+
+        if (resume)
+          resume.resume();
+      }
+    };
+  } // namespace detail
+
+  /**
+   * @brief The eventual Result<T> of a job started with Spawn().
+   * @details Copies refer to the same job.
+   */
+  template <typename T>
+  class Task {
+   public:
+    /**
+     * @brief Wraps shared state; use Spawn() rather than constructing a Task directly.
+     */
+    explicit Task(SharedPointer<detail::TaskState<T>> state) : m_state(std::move(state)) {}
+
+    /**
+     * @brief Whether a result (or cancellation) is available without waiting.
+     */
+    [[nodiscard]] fn ready() const -> bool {
+      LockGuard lock(m_state->mutex);
+      return m_state->result.has_value();
+    }
+
+    /**
+     * @brief Waits for and returns the result. Can only be called once.
+     */
+    fn get() -> Result<T> {
+      std::unique_lock lock(m_state->mutex);
+      m_state->done.wait(lock, [this] { return m_state->result.has_value(); });
+      return std::move(*m_state->result);
+    }
+
+    /**
+     * @brief Waits until the result is available or @p deadline passes.
+     * @return Whether the result is available.
+     */
+    template <typename Clock, typename Duration>
+    fn waitUntil(const std::chrono::time_point<Clock, Duration>& deadline) const -> bool {
+      std::unique_lock lock(m_state->mutex);
+      return m_state->done.wait_until(lock, deadline, [this] { return m_state->result.has_value(); });
+    }
+
+    template <typename Rep, typename Period>
+    fn waitFor(const std::chrono::duration<Rep, Period>& timeout) const -> bool {
+      return waitUntil(std::chrono::steady_clock::now() + timeout);
+    }
+
+    /**
+     * @brief Asks the job to stop and completes the task with a Cancelled error right away.
+     *
+     * @details The job's stop token is signalled. A job that hasn't started
+     * yet is skipped; one that is already running finishes in the background
+     * (sooner, if it checks its stop token) and its result is discarded. A
+     * no-op if the task has already completed.
+     */
+    fn cancel() -> Unit {
+      if (ready())
+        return;
+
+      m_state->stop.request_stop();
+      m_state->complete(Err(DracError(DracErrorCode::Cancelled, "Task was cancelled")));
+    }
+
+    /**
+     * @brief Stop token passed to the job, if it accepts one.
+     */
+    [[nodiscard]] fn stopToken() const -> std::stop_token {
+      return m_state->stop.get_token();
+    }
+
+    // Awaiter interface, so a Task can be co_await'ed directly.
+    [[nodiscard]] fn await_ready() const -> bool {
+      return ready();
+    }
+
+    fn await_suspend(const std::coroutine_handle<> continuation) -> bool {
+      LockGuard lock(m_state->mutex);
+
+      if (m_state->result)
+        return false; // Finished while we were getting here; resume immediately.
+
+      m_state->continuation = continuation;
+      return true;
+    }
+
+    fn await_resume() -> Result<T> {
+      return get();
+    }
+
+   private:
+    SharedPointer<detail::TaskState<T>> m_state;
+  };
+
+  /**
+   * @brief Runs @p job on @p pool and returns a Task for its result.
+   *
+   * @param job Returns a Result<T>. It may take a std::stop_token, which is
+   * signalled when the task is cancelled; it also runs inside a
+   * CancellationScope for that token. Anything it throws becomes an
+   * InternalError result.
+   */
+  template <typename F>
+  fn Spawn(F&& job, ThreadPool& pool = ThreadPool::shared()) -> Task<typename detail::JobResult<std::decay_t<F>>::value_type> {
+    using T = detail::JobResult<std::decay_t<F>>::value_type;
+
+    auto state = std::make_shared<detail::TaskState<T>>();
+
+    (void)pool.submit([state, job = std::forward<F>(job)]() mutable -> Unit {
+      const std::stop_token token = state->stop.get_token();
+
+      if (token.stop_requested())
+        return; // Cancelled before it got a thread; cancel() already completed it.
+
+      Option<Result<T>> result;
+
+      {
+        // Lets readouts that check for cancellation notice cancel() while they run.
+        const CancellationScope scope(token);
+
+        try {
+          if constexpr (std::is_invocable_v<decltype(job), std::stop_token>)
+            result.emplace(job(token));
+          else
+            result.emplace(job());
+        } catch (const std::exception& e) {
+          result.emplace(Err(DracError(DracErrorCode::InternalError, e.what())));
+        } catch (...) {
+          result.emplace(Err(DracError(DracErrorCode::InternalError, "Task threw a non-standard exception")));
+        }
+      }
+
+      // Only once the scope is gone: complete() may resume an awaiting coroutine
+      // right here, and that shouldn't run under this job's token and deadline.
+      state->complete(std::move(*result));
+    });
+
+    return Task<T>(std::move(state));
+  }
+} // namespace draconis::utils::threading
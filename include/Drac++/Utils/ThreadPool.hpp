@@ -0,0 +1,162 @@
+/**
+ * @file ThreadPool.hpp
+ * @brief Small on-demand thread pool for running independent readouts concurrently.
+ *
+ * Workers are started lazily, one whenever a task is submitted and none is
+ * idle, up to a fixed maximum. Readouts mostly wait on I/O (X11/Wayland
+ * connections, DBus round trips, sqlite, directory scans), so the pool is
+ * sized for concurrency rather than for the number of cores.
+ */
+
+#pragma once
+
+#include <condition_variable> // std::condition_variable
+#include <deque>              // std::deque
+#include <exception>          // std::current_exception
+#include <future>             // std::promise
+#include <thread>             // std::jthread
+#include <type_traits>        // std::{invoke_result_t, is_void_v}
+
+#include "Types.hpp"
+
+namespace draconis::utils::threading {
+  namespace {
+    using types::Fn;
+    using types::Future;
+    using types::LockGuard;
+    using types::Mutex;
+    using types::Unit;
+    using types::usize;
+    using types::Vec;
+  } // namespace
+
+  class ThreadPool {
+   public:
+    /**
+     * @param maxThreads Upper bound on the number of worker threads.
+     */
+    explicit ThreadPool(const usize maxThreads) : m_maxThreads(maxThreads == 0 ? 1 : maxThreads) {}
+
+    /**
+     * @brief Finishes the queued tasks, then joins every worker.
+     */
+    ~ThreadPool() {
+      {
+        LockGuard lock(m_mutex);
+        m_stopping = true;
+      }
+
+      m_wake.notify_all();
+      m_workers.clear(); // joins
+    }
+
+    ThreadPool(const ThreadPool&)                = delete;
+    ThreadPool(ThreadPool&&)                     = delete;
+    fn operator=(const ThreadPool&)->ThreadPool& = delete;
+    fn operator=(ThreadPool&&)->ThreadPool&      = delete;
+
+    /**
+     * @brief The process-wide pool used by the library and the CLI.
+     *
+     * @details Deliberately never destroyed: a readout that is stuck past its
+     * deadline must not be able to hold up process exit by being joined.
+     */
+    static fn shared() -> ThreadPool& {
+      static ThreadPool* pool = new ThreadPool(SHARED_MAX_THREADS); // NOLINT(cppcoreguidelines-owning-memory)
+      return *pool;
+    }
+
+    /**
+     * @brief Queues @p task and returns a future for its result.
+     * @details Exceptions thrown by @p task are stored in the future.
+     */
+    template <typename F>
+    fn submit(F&& task) -> Future<std::invoke_result_t<std::decay_t<F>>> {
+      using R = std::invoke_result_t<std::decay_t<F>>;
+
+      // std::function needs a copyable target, so the task and its promise are shared.
+      auto body    = std::make_shared<std::decay_t<F>>(std::forward<F>(task));
+      auto promise = std::make_shared<std::promise<R>>();
+
+      Future<R> future = promise->get_future();
+
+      {
+        LockGuard lock(m_mutex);
+
+        m_queue.emplace_back([body, promise]() -> Fn<Unit()> {
+          try {
+            if constexpr (std::is_void_v<R>) {
+              (*body)();
+              return [promise] { promise->set_value(); };
+            } else
+              return [promise, result = std::make_shared<R>((*body)())] { promise->set_value(std::move(*result)); };
+          } catch (...) {
+            return [promise, error = std::current_exception()] { promise->set_exception(error); };
+          }
+        });
+
+        if (m_idle < m_queue.size() && m_workers.size() < m_maxThreads)
+          m_workers.emplace_back([this] { workerLoop(); });
+      }
+
+      m_wake.notify_one();
+
+      return future;
+    }
+
+    /**
+     * @brief Number of tasks that are queued or still running.
+     */
+    [[nodiscard]] fn pending() const -> usize {
+      LockGuard lock(m_mutex);
+      return m_queue.size() + m_running;
+    }
+
+    static constexpr usize SHARED_MAX_THREADS = 16;
+
+   private:
+    /// Runs a task and returns what stores its result (or exception) in the task's future.
+    using Job = Fn<Fn<Unit()>()>;
+
+    fn workerLoop() -> Unit {
+      std::unique_lock lock(m_mutex);
+
+      while (true) {
+        ++m_idle;
+        m_wake.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+        --m_idle;
+
+        if (m_queue.empty())
+          return; // Stopping and nothing left to do.
+
+        const Job job = std::move(m_queue.front());
+        m_queue.pop_front();
+
+        ++m_running;
+        lock.unlock();
+
+        const Fn<Unit()> publish = job();
+
+        // Only make the future ready once the task no longer counts as
+        // running, so whoever sees it ready also sees pending() drop.
+        lock.lock();
+        --m_running;
+        lock.unlock();
+
+        publish();
+
+        lock.lock();
+      }
+    }
+
+    usize m_maxThreads;
+
+    mutable Mutex           m_mutex; ///< Guards everything below.
+    std::condition_variable m_wake;
+    std::deque<Job>         m_queue;
+    Vec<std::jthread>       m_workers;
+    usize                   m_idle     = 0; ///< Workers waiting for a task.
+    usize                   m_running  = 0; ///< Tasks currently executing.
+    bool                    m_stopping = false;
+  };
+} // namespace draconis::utils::threading
@@ -13,6 +13,7 @@
 #include <expected>      // std::expected
 #include <functional>    // std::function (Fn)
 #include <future>        // std::future (Future)
+#include <list>          // std::list (List)
 #include <map>           // std::map (Map)
 #include <memory>        // std::shared_ptr and std::unique_ptr (SharedPointer, UniquePointer)
 #include <mutex>         // std::mutex and std::lock_guard (Mutex, LockGuard)
@@ -21,6 +22,7 @@
 #include <string>        // std::string (String, StringView)
 #include <string_view>   // std::string_view (StringView)
 #include <unordered_map> // std::unordered_map (UnorderedMap)
+#include <unordered_set> // std::unordered_set (UnorderedSet)
 #include <utility>       // std::pair (Pair)
 #include <vector>        // std::vector (Vec)
 
@@ -254,6 +256,15 @@ namespace draconis::utils {
     template <typename Tp>
     using Vec = std::vector<Tp>;
 
+    /**
+     * @brief Alias for std::list<Tp>.
+     *
+     * Represents a doubly-linked list, for when iterators must stay valid across insertions and removals.
+     * @tparam Tp The element type.
+     */
+    template <typename Tp>
+    using List = std::list<Tp>;
+
     /**
      * @brief Alias for std::span<Tp, sz>.
      *
@@ -303,6 +314,15 @@ namespace draconis::utils {
     template <typename Key, typename Val>
     using UnorderedMap = std::unordered_map<Key, Val>;
 
+    /**
+     * @brief Alias for std::unordered_set<Key>.
+     *
+     * Represents an unordered set of unique keys.
+     * @tparam Key The key type.
+     */
+    template <typename Key>
+    using UnorderedSet = std::unordered_set<Key>;
+
     /**
      * @brief Alias for std::shared_ptr<Tp>.
      *
@@ -111,6 +111,8 @@
         "-Dbuild_examples=false"
         "-Dbuild_switch_example=false"
         "-Duse_linked_pci_ids=true"
+        "-Dpci_ids=${pkgs.pciutils}/share/pci.ids"
+        "-Dpci_ids_display_only=true"
       ];
 
       buildInputs = deps;
@@ -120,13 +122,6 @@
       '';
 
       buildPhase = ''
-        cp ${pkgs.pciutils}/share/pci.ids pci.ids
-        chmod +w pci.ids
-        objcopy -I binary -O default pci.ids pci_ids.o
-        rm pci.ids
-
-        export LDFLAGS="$LDFLAGS $PWD/pci_ids.o"
-
         meson compile -C build
       '';
 
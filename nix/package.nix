@@ -82,24 +82,16 @@
         "-Dbuild_examples=false"
         "-Dbuild_switch_example=false"
         (lib.optionalString stdenv.isLinux "-Duse_linked_pci_ids=true")
+        (lib.optionalString stdenv.isLinux "-Dpci_ids=${pkgs.pciutils}/share/pci.ids")
       ];
 
       configurePhase = ''
         meson setup build --buildtype=release $mesonFlags
       '';
 
-      buildPhase =
-        lib.optionalString stdenv.isLinux ''
-          cp ${pkgs.pciutils}/share/pci.ids pci.ids
-          chmod +w pci.ids
-          objcopy -I binary -O default pci.ids pci_ids.o
-          rm pci.ids
-
-          export LDFLAGS="$LDFLAGS $PWD/pci_ids.o"
-        ''
-        + ''
-          meson compile -C build
-        '';
+      buildPhase = ''
+        meson compile -C build
+      '';
 
       checkPhase = ''
         meson test -C build --print-errorlogs
@@ -87,6 +87,7 @@ namespace {
 # General settings
 [general]
 name = "{}" # Your display name
+readout_timeout_ms = 2000 # Give up on readouts that take longer than this (0 waits forever)
 )toml",
                                          defaultName);
 
@@ -26,6 +26,8 @@
   #include <Drac++/Services/Packages.hpp>
 #endif
 
+#include <chrono> // std::chrono::milliseconds
+
 #include <Drac++/Utils/Logging.hpp>
 #include <Drac++/Utils/Types.hpp>
 
@@ -38,6 +40,11 @@ namespace draconis::config {
     mutable draconis::utils::types::Option<draconis::utils::types::String> name;     ///< Display name; resolved lazily via getDefaultName() when needed.
     draconis::utils::types::Option<draconis::utils::types::String>         language; ///< Language code for localization (e.g., "en", "es", "fr")
 
+    static constexpr std::chrono::milliseconds DEFAULT_READOUT_TIMEOUT = std::chrono::milliseconds(2000);
+
+    /// How long to wait for the slowest readout before reporting it as timed out. Zero waits indefinitely.
+    std::chrono::milliseconds readoutTimeout = DEFAULT_READOUT_TIMEOUT;
+
     /**
      * @brief Retrieves the default name for the user.
      * @return The default name for the user, either from the system or a fallback.
@@ -87,7 +94,7 @@ namespace draconis::config {
      * @return A General instance with the parsed values, or defaults otherwise.
      */
     static fn fromToml(const toml::table& tbl) -> General {
-      using draconis::utils::types::String;
+      using draconis::utils::types::i64, draconis::utils::types::String;
 
       General gen;
 
@@ -99,6 +106,10 @@ namespace draconis::config {
         if (auto langVal = langNode.value<String>())
           gen.language = *langVal;
 
+      if (const toml::node_view<const toml::node> timeoutNode = tbl["readout_timeout_ms"])
+        if (auto timeoutVal = timeoutNode.value<i64>(); timeoutVal && *timeoutVal >= 0)
+          gen.readoutTimeout = std::chrono::milliseconds(*timeoutVal);
+
       return gen;
     }
 #endif // DRAC_PRECOMPILED_CONFIG
@@ -2,8 +2,11 @@
 
 #include <Drac++/Core/System.hpp>
 
+#include <Drac++/Utils/CacheManager.hpp>
+#include <Drac++/Utils/Cancellation.hpp>
 #include <Drac++/Utils/Error.hpp>
 #include <Drac++/Utils/Logging.hpp>
+#include <Drac++/Utils/ThreadPool.hpp>
 #include <Drac++/Utils/Types.hpp>
 
 #include "Config/Config.hpp"
@@ -13,9 +16,15 @@ namespace draconis::core::system {
     using draconis::config::Config;
     using namespace draconis::utils::types;
 
+    using draconis::utils::cache::CacheLocation;
+    using draconis::utils::cache::CachePolicy;
+    using draconis::utils::cancellation::CancellationScope;
     using draconis::utils::error::DracError;
+    using draconis::utils::threading::ThreadPool;
     using enum draconis::utils::error::DracErrorCode;
 
+    using std::chrono::steady_clock;
+
     fn GetDate() -> Result<String> {
       using std::chrono::system_clock;
 
@@ -54,6 +63,31 @@ namespace draconis::core::system {
 
       ERR(ParseError, "Failed to get local time");
     }
+
+    /**
+     * @brief Starts @p readout on the shared thread pool, inside a CancellationScope for @p deadline.
+     * @details Readouts that check their scope give up by themselves at the
+     * deadline instead of running on after nobody is waiting for them.
+     */
+    template <typename F>
+    fn StartReadout(const Option<steady_clock::time_point> deadline, F readout) -> Future<std::invoke_result_t<F>> {
+      return ThreadPool::shared().submit([deadline, readout = std::move(readout)] {
+        const CancellationScope scope(deadline);
+        return readout();
+      });
+    }
+
+    /**
+     * @brief Waits for a readout started on the thread pool, giving up at @p deadline.
+     * @details A readout that can't be interrupted keeps running in the background; its result is discarded.
+     */
+    template <typename T>
+    fn AwaitReadout(Future<Result<T>>& readout, const Option<steady_clock::time_point> deadline, const StringView name) -> Result<T> {
+      if (deadline && readout.wait_until(*deadline) != std::future_status::ready)
+        ERR_FMT(Timeout, "{} did not finish before the readout deadline", name);
+
+      return readout.get();
+    }
   } // namespace
 
   SystemInfo::SystemInfo(utils::cache::CacheManager& cache, const Config& config) {
@@ -74,24 +108,75 @@ namespace draconis::core::system {
       return str;
     };
 
-    this->desktopEnv      = GetDesktopEnvironment(cache);
-    this->windowMgr       = GetWindowManager(cache);
-    this->operatingSystem = GetOperatingSystem(cache);
-    this->kernelVersion   = GetKernelVersion(cache);
-    this->host            = GetHost(cache);
-    this->cpuModel        = replaceTrademarkSymbols(GetCPUModel(cache));
-    this->cpuCores        = GetCPUCores(cache);
-    this->gpuModel        = GetGPUModel(cache);
-    this->shell           = GetShell(cache);
-    this->memInfo         = GetMemInfo(cache);
-    this->diskUsage       = GetDiskUsage(cache);
-    this->uptime          = GetUptime();
-    this->date            = GetDate();
-
-    if constexpr (DRAC_ENABLE_PACKAGECOUNT)
-      this->packageCount = draconis::services::packages::GetTotalCount(cache, config.enabledPackageManagers);
-
-    if constexpr (DRAC_ENABLE_NOWPLAYING)
-      this->nowPlaying = config.nowPlaying.enabled ? GetNowPlaying() : Err(DracError(ApiUnavailable, "Now Playing API disabled"));
+    // Each readout below goes through its own getOrSet(), so write their
+    // entries out together instead of one store append per readout.
+    const utils::cache::CacheManager::WriteBatch batch(cache);
+
+    // The readouts are independent, so run them all at once and only wait as
+    // long as the slowest one, up to the configured deadline. The tasks only
+    // capture the cache, which outlives every readout in main().
+    const Option<steady_clock::time_point> deadline = config.general.readoutTimeout.count() > 0
+      ? Option<steady_clock::time_point>(steady_clock::now() + config.general.readoutTimeout)
+      : None;
+
+    Future<Result<String>>        desktopEnvTask      = StartReadout(deadline, [&cache] { return GetDesktopEnvironment(cache); });
+    Future<Result<String>>        windowMgrTask       = StartReadout(deadline, [&cache] { return GetWindowManager(cache); });
+    Future<Result<OSInfo>>        operatingSystemTask = StartReadout(deadline, [&cache] { return GetOperatingSystem(cache); });
+    Future<Result<String>>        kernelVersionTask   = StartReadout(deadline, [&cache] { return GetKernelVersion(cache); });
+    Future<Result<String>>        hostTask            = StartReadout(deadline, [&cache] { return GetHost(cache); });
+    Future<Result<String>>        cpuModelTask        = StartReadout(deadline, [&cache] { return GetCPUModel(cache); });
+    Future<Result<CPUCores>>      cpuCoresTask        = StartReadout(deadline, [&cache] { return GetCPUCores(cache); });
+    Future<Result<String>>        gpuModelTask        = StartReadout(deadline, [&cache] { return GetGPUModel(cache); });
+    Future<Result<String>>        shellTask           = StartReadout(deadline, [&cache] { return GetShell(cache); });
+    Future<Result<ResourceUsage>> memInfoTask         = StartReadout(deadline, [&cache] { return GetMemInfo(cache); });
+    Future<Result<ResourceUsage>> diskUsageTask       = StartReadout(deadline, [&cache] { return GetDiskUsage(cache); });
+
+#if DRAC_ENABLE_PACKAGECOUNT
+    Future<Result<u64>> packageCountTask = StartReadout(deadline, [&cache, managers = config.enabledPackageManagers] {
+      return draconis::services::packages::GetTotalCount(cache, managers);
+    });
+#endif
+
+#if DRAC_ENABLE_NOWPLAYING
+    Option<Future<Result<MediaInfo>>> nowPlayingTask;
+
+    if (config.nowPlaying.enabled)
+      nowPlayingTask = StartReadout(deadline, [&cache] {
+        // Only the absence of a player is cached; the track itself changes too often.
+        const CachePolicy nowPlayingPolicy {
+          .location    = CacheLocation::TempDirectory,
+          .ttl         = seconds(0),
+          .negativeTtl = seconds(30),
+        };
+
+        return cache.getOrSet<MediaInfo>("now_playing", nowPlayingPolicy, GetNowPlaying);
+      });
+#endif
+
+    // Cheap enough to not be worth a thread.
+    this->uptime = GetUptime();
+    this->date   = GetDate();
+
+    this->desktopEnv      = AwaitReadout(desktopEnvTask, deadline, "DesktopEnvironment");
+    this->windowMgr       = AwaitReadout(windowMgrTask, deadline, "WindowManager");
+    this->operatingSystem = AwaitReadout(operatingSystemTask, deadline, "OperatingSystem");
+    this->kernelVersion   = AwaitReadout(kernelVersionTask, deadline, "KernelVersion");
+    this->host            = AwaitReadout(hostTask, deadline, "Host");
+    this->cpuModel        = replaceTrademarkSymbols(AwaitReadout(cpuModelTask, deadline, "CPUModel"));
+    this->cpuCores        = AwaitReadout(cpuCoresTask, deadline, "CPUCores");
+    this->gpuModel        = AwaitReadout(gpuModelTask, deadline, "GPUModel");
+    this->shell           = AwaitReadout(shellTask, deadline, "Shell");
+    this->memInfo         = AwaitReadout(memInfoTask, deadline, "MemoryInfo");
+    this->diskUsage       = AwaitReadout(diskUsageTask, deadline, "DiskUsage");
+
+#if DRAC_ENABLE_PACKAGECOUNT
+    this->packageCount = AwaitReadout(packageCountTask, deadline, "PackageCount");
+#endif
+
+#if DRAC_ENABLE_NOWPLAYING
+    this->nowPlaying = nowPlayingTask
+      ? AwaitReadout(*nowPlayingTask, deadline, "NowPlaying")
+      : Err(DracError(ApiUnavailable, "Now Playing API disabled"));
+#endif
   }
 } // namespace draconis::core::system
@@ -86,15 +86,6 @@ namespace glz {
     static constexpr detail::Object value = object("usedBytes", &T::usedBytes, "totalBytes", &T::totalBytes);
   };
 
-#if DRAC_ENABLE_NOWPLAYING
-  template <>
-  struct meta<draconis::utils::types::MediaInfo> {
-    using T = draconis::utils::types::MediaInfo;
-
-    static constexpr detail::Object value = object("title", &T::title, "artist", &T::artist);
-  };
-#endif
-
   template <>
   struct meta<draconis::core::system::JsonInfo> {
     using T = draconis::core::system::JsonInfo;
@@ -0,0 +1,158 @@
+/**
+ * @file SystemInfoBenchmark.cpp
+ * @brief Cold-start benchmark for the SystemInfo constructor across cache storage layouts.
+ *
+ * Each sample builds a fresh CacheManager (so the in-memory tier is empty, as
+ * it is on every CLI invocation) and constructs SystemInfo with the CLI's
+ * TempDirectory policy. Every cached readout is therefore served from disk,
+ * which is what differs between CacheStorage::PerKeyFiles and
+ * CacheStorage::MappedFile.
+ *
+ * The entries go to a scratch temp directory that is removed afterwards,
+ * not the user's real temp cache.
+ *
+ * Run with `meson test --benchmark` or execute the binary directly.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+#include <Drac++/Utils/CacheManager.hpp>
+#include <Drac++/Utils/Env.hpp>
+#include <Drac++/Utils/Logging.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "Config/Config.hpp"
+#include "Core/SystemInfo.hpp"
+
+using namespace draconis::utils;
+
+using draconis::config::Config;
+using draconis::core::system::SystemInfo;
+
+using cache::CacheManager;
+using cache::CachePolicy;
+using cache::CacheStorage;
+
+using types::Array;
+using types::f64;
+using types::i32;
+using types::PCStr;
+using types::usize;
+using types::Vec;
+
+using std::chrono::duration;
+using std::chrono::steady_clock;
+
+namespace fs = std::filesystem;
+
+namespace {
+  constexpr usize ITERATIONS = 50;
+
+#ifdef _WIN32
+  constexpr PCStr TEMP_ENV = "TMP"; // The first variable GetTempPath() checks.
+#else
+  constexpr PCStr TEMP_ENV = "TMPDIR";
+#endif
+
+  struct Layout {
+    PCStr        name;
+    CacheStorage storage;
+  };
+
+  struct Summary {
+    f64 minMs;
+    f64 medianMs;
+    f64 meanMs;
+  };
+
+  fn ColdStart(const CacheStorage storage, const Config& config) -> f64 {
+    CachePolicy policy = CachePolicy::tempDirectory();
+    policy.storage     = storage;
+
+    CacheManager cache;
+    cache.setGlobalPolicy(policy);
+
+    const steady_clock::time_point begin = steady_clock::now();
+
+    const SystemInfo info(cache, config);
+    (void)info;
+
+    return duration<f64, std::milli>(steady_clock::now() - begin).count();
+  }
+
+  fn Run(const CacheStorage storage, const Config& config) -> Summary {
+    // Populate the on-disk entries first so every measured run is a disk hit.
+    (void)ColdStart(storage, config);
+
+    Vec<f64> samples;
+    samples.reserve(ITERATIONS);
+
+    for (usize i = 0; i < ITERATIONS; ++i)
+      samples.push_back(ColdStart(storage, config));
+
+    std::ranges::sort(samples);
+
+    f64 total = 0.0;
+
+    for (const f64 sample : samples)
+      total += sample;
+
+    return {
+      .minMs    = samples.front(),
+      .medianMs = samples[samples.size() / 2],
+      .meanMs   = total / static_cast<f64>(samples.size()),
+    };
+  }
+} // namespace
+
+fn main() -> i32 {
+  using logging::Println;
+
+  constexpr Array<Layout, 2> layouts = { {
+    { .name = "per-key files", .storage = CacheStorage::PerKeyFiles },
+    { .name = "mapped file", .storage = CacheStorage::MappedFile },
+  } };
+
+  // CacheManager::getTempCacheDir() follows the temp directory, so this keeps
+  // every TempDirectory entry the benchmark writes in one place it can remove.
+  const fs::path scratch = fs::temp_directory_path() / "draconis_benchmark";
+
+  fs::remove_all(scratch);
+  fs::create_directories(scratch);
+  env::SetEnv(TEMP_ENV, scratch.string().c_str());
+
+  // Defaults only; the user's config file shouldn't affect the numbers.
+  Config config;
+
+#if DRAC_ENABLE_NOWPLAYING
+  // Only Now Playing failures are cached, so it would mostly add IPC noise.
+  config.nowPlaying.enabled = false;
+#endif
+
+  Println("SystemInfo cold-start benchmark ({} iterations per layout)", ITERATIONS);
+  Println("{:>14} {:>10} {:>10} {:>10} {:>10}", "layout", "min", "median", "mean", "speedup");
+
+  f64 baselineMedian = 0.0;
+
+  for (const Layout& layout : layouts) {
+    const Summary summary = Run(layout.storage, config);
+
+    if (baselineMedian == 0.0)
+      baselineMedian = summary.medianMs;
+
+    Println(
+      "{:>14} {:>8.3f}ms {:>8.3f}ms {:>8.3f}ms {:>9.2f}x",
+      layout.name,
+      summary.minMs,
+      summary.medianMs,
+      summary.meanMs,
+      baselineMedian / summary.medianMs
+    );
+  }
+
+  fs::remove_all(scratch);
+
+  return 0;
+}
@@ -4,7 +4,16 @@
   #include <windows.h>
 #endif
 
+#include <cstdio>  // std::fflush
+#include <cstdlib> // std::_Exit
+
+#ifndef _WIN32
+  #include <csignal> // std::{signal, sig_atomic_t}, SIGINT, SIGTERM
+  #include <thread>  // std::this_thread::sleep_for
+#endif
+
 #include <Drac++/Core/System.hpp>
+#include <Drac++/Services/LiveMetrics.hpp>
 #include <Drac++/Services/Packages.hpp>
 
 #if DRAC_ENABLE_WEATHER
@@ -15,9 +24,11 @@
 
 #include <Drac++/Utils/ArgumentParser.hpp>
 #include <Drac++/Utils/CacheManager.hpp>
+#include <Drac++/Utils/Cancellation.hpp>
 #include <Drac++/Utils/Error.hpp>
 #include <Drac++/Utils/Localization.hpp>
 #include <Drac++/Utils/Logging.hpp>
+#include <Drac++/Utils/ThreadPool.hpp>
 #include <Drac++/Utils/Types.hpp>
 
 #include "Config/Config.hpp"
@@ -155,6 +166,71 @@ namespace {
     else
       WriteToConsole(jsonStr);
   }
+
+  fn PrintCacheStats(const draconis::utils::cache::CacheManager& cache) -> Unit {
+    using draconis::utils::cache::CacheKeyStats;
+
+    const Map<String, CacheKeyStats> stats = cache.stats();
+
+    if (stats.empty()) {
+      Println("No cache activity was recorded.");
+      return;
+    }
+
+    Println("\n{:<36} {:>6} {:>6} {:>6} {:>6} {:>10} {:>10} {:>10}", "key", "memory", "disk", "miss", "failed", "fetch", "read", "written");
+
+    u64 totalFetchNs = 0;
+
+    for (const auto& [key, entry] : stats) {
+      totalFetchNs += entry.fetchNs;
+
+      Println(
+        "{:<36} {:>6} {:>6} {:>6} {:>6} {:>8.2f}ms {:>9}B {:>9}B",
+        key,
+        entry.memoryHits,
+        entry.diskHits,
+        entry.misses,
+        entry.fetchFailures,
+        static_cast<f64>(entry.fetchNs) / 1e6,
+        entry.bytesRead,
+        entry.bytesWritten
+      );
+    }
+
+    Println("Total time spent in fetchers: {:.2f}ms", static_cast<f64>(totalFetchNs) / 1e6);
+  }
+
+#ifndef _WIN32
+  volatile std::sig_atomic_t StopPublishing = 0;
+
+  constexpr std::chrono::seconds PUBLISH_INTERVAL = std::chrono::seconds(1);
+
+  /**
+   * @brief Keeps the live-metrics segment up to date until SIGINT/SIGTERM.
+   */
+  fn RunPublisher(draconis::utils::cache::CacheManager& cache) -> i32 {
+    using namespace draconis::services::metrics;
+
+    Result<UniquePointer<Publisher>> publisher = Publisher::create();
+
+    if (!publisher) {
+      error_at(publisher.error());
+      return EXIT_FAILURE;
+    }
+
+    std::signal(SIGINT, [](i32) { StopPublishing = 1; });
+    std::signal(SIGTERM, [](i32) { StopPublishing = 1; });
+
+    info_log("Publishing live metrics to {} every {}s", DefaultSegmentName(), PUBLISH_INTERVAL.count());
+
+    while (StopPublishing == 0) {
+      (*publisher)->publish(CollectSnapshot(cache));
+      std::this_thread::sleep_for(PUBLISH_INTERVAL);
+    }
+
+    return EXIT_SUCCESS;
+  }
+#endif
 } // namespace
 
 fn main(const i32 argc, CStr* argv[]) -> i32 try {
@@ -167,11 +243,13 @@ fn main(const i32 argc, CStr* argv[]) -> i32 try {
     doctorMode,
     clearCache,
     ignoreCacheRun,
+    cacheStats,
+    publish,
     noAscii,
     jsonOutput,
     prettyJson,
     language
-  ] = Tuple(false, false, false, false, false, false, String(""));
+  ] = Tuple(false, false, false, false, false, false, false, false, String(""));
   // clang-format on
 
   {
@@ -209,6 +287,16 @@ fn main(const i32 argc, CStr* argv[]) -> i32 try {
       .help("Ignore cache for this run (fetch fresh data without reading/writing on-disk cache).")
       .flag();
 
+    parser
+      .addArguments("--cache-stats")
+      .help("Print per-key cache hits, misses, fetch times and bytes read/written after the output.")
+      .flag();
+
+    parser
+      .addArguments("--publish")
+      .help("Keep running and publish memory, uptime, battery and now playing to shared memory for other programs to read.")
+      .flag();
+
     parser
       .addArguments("--no-ascii")
       .help("Disable ASCII art display.")
@@ -232,6 +320,8 @@ fn main(const i32 argc, CStr* argv[]) -> i32 try {
     doctorMode     = parser.get<bool>("-d") || parser.get<bool>("--doctor");
     clearCache     = parser.get<bool>("--clear-cache");
     ignoreCacheRun = parser.get<bool>("--ignore-cache");
+    cacheStats     = parser.get<bool>("--cache-stats");
+    publish        = parser.get<bool>("--publish");
     noAscii        = parser.get<bool>("--no-ascii");
     jsonOutput     = parser.get<bool>("--json");
     prettyJson     = parser.get<bool>("--pretty");
@@ -251,7 +341,14 @@ fn main(const i32 argc, CStr* argv[]) -> i32 try {
   if (ignoreCacheRun)
     CacheManager::ignoreCache = true;
 
-  cache.setGlobalPolicy(CachePolicy::tempDirectory());
+  {
+    // Remember "not present" results for a few minutes so runs in quick
+    // succession don't keep re-probing things that aren't there.
+    CachePolicy policy = CachePolicy::tempDirectory();
+    policy.negativeTtl = std::chrono::minutes(5);
+
+    cache.setGlobalPolicy(policy);
+  }
 
   if (clearCache) {
     const u8 removedCount = cache.invalidateAll(true);
@@ -264,6 +361,15 @@ fn main(const i32 argc, CStr* argv[]) -> i32 try {
     return EXIT_SUCCESS;
   }
 
+  if (publish) {
+#ifdef _WIN32
+    error_log("--publish is not supported on Windows");
+    return EXIT_FAILURE;
+#else
+    return RunPublisher(cache);
+#endif
+  }
+
 #ifndef NDEBUG
   if (Result<CPUCores> cpuCores = GetCPUCores(cache))
     debug_log("CPU cores: {} physical, {} logical", cpuCores->physical, cpuCores->logical);
@@ -316,33 +422,51 @@ fn main(const i32 argc, CStr* argv[]) -> i32 try {
     debug_log("Current language: {}", translationManager.getCurrentLanguage());
     debug_log("Selected language: {}", language.empty() ? "auto" : language);
 
-    SystemInfo data(cache, config);
+    using draconis::utils::threading::ThreadPool;
 
 #if DRAC_ENABLE_WEATHER
     using enum draconis::utils::error::DracErrorCode;
 
+    // Start the HTTP request first so it overlaps with the local readouts.
+    const std::chrono::steady_clock::time_point weatherStart = std::chrono::steady_clock::now();
+
+    Option<Future<Result<Report>>> weatherTask;
+
+    const Option<std::chrono::steady_clock::time_point> weatherDeadline = config.general.readoutTimeout.count() > 0
+      ? Option<std::chrono::steady_clock::time_point>(weatherStart + config.general.readoutTimeout)
+      : None;
+
+    if (config.weather.enabled && config.weather.service != nullptr)
+      weatherTask = ThreadPool::shared().submit([service = config.weather.service.get(), weatherDeadline] {
+        // Lets curl abandon the request at the deadline instead of running on unobserved.
+        const draconis::utils::cancellation::CancellationScope scope(weatherDeadline);
+        return service->getWeatherInfo();
+      });
+#endif
+
+    SystemInfo data(cache, config);
+
+#if DRAC_ENABLE_WEATHER
     Result<Report> weatherReport;
 
     if (config.weather.enabled && config.weather.service == nullptr)
       weatherReport = Err({ Other, "Weather service is not configured" });
-    else if (config.weather.enabled)
-      weatherReport = config.weather.service->getWeatherInfo();
-    else
+    else if (!weatherTask)
       weatherReport = Err({ ApiUnavailable, "Weather is disabled" });
+    else if (weatherDeadline && weatherTask->wait_until(*weatherDeadline) != std::future_status::ready)
+      weatherReport = Err({ Timeout, "Weather did not finish before the readout deadline" });
+    else
+      weatherReport = weatherTask->get();
 #endif
 
-    if (doctorMode) {
+    if (doctorMode)
       PrintDoctorReport(
 #if DRAC_ENABLE_WEATHER
         weatherReport,
 #endif
         data
       );
-
-      return EXIT_SUCCESS;
-    }
-
-    if (jsonOutput)
+    else if (jsonOutput)
       PrintJsonOutput(
 #if DRAC_ENABLE_WEATHER
         weatherReport,
@@ -359,6 +483,16 @@ fn main(const i32 argc, CStr* argv[]) -> i32 try {
 #endif
         noAscii
       ));
+
+    if (cacheStats)
+      PrintCacheStats(cache);
+
+    // A readout that missed its deadline may still be running against the
+    // config and cache, so leave without tearing either down underneath it.
+    if (ThreadPool::shared().pending() > 0) {
+      std::fflush(nullptr);
+      std::_Exit(EXIT_SUCCESS);
+    }
   }
 
   return EXIT_SUCCESS;
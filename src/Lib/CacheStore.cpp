@@ -0,0 +1,593 @@
+#include <Drac++/Utils/CacheStore.hpp>
+
+#include <cerrno>   // errno
+#include <cstring>  // std::{memcpy, strerror}
+#include <fstream>  // std::{ifstream, ofstream, fstream}
+#include <iterator> // std::istreambuf_iterator
+
+#ifndef _WIN32
+  #include <fcntl.h>    // open, O_RDWR, O_WRONLY, O_CREAT, O_EXCL, O_CLOEXEC
+  #include <sys/file.h> // flock, LOCK_EX, LOCK_UN
+  #include <sys/mman.h> // mmap, munmap
+  #include <sys/stat.h> // fstat, stat
+  #include <unistd.h>   // close, pread, pwrite, unlink, write
+#endif
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Logging.hpp>
+
+using enum draconis::utils::error::DracErrorCode;
+
+namespace draconis::utils::cache {
+  namespace {
+    using types::Array;
+    using types::isize;
+    using types::LockGuard;
+    using types::None;
+    using types::Unit;
+
+    constexpr Array<char, 8> STORE_MAGIC    = { 'D', 'R', 'A', 'C', 'S', 'T', '0', '1' };
+    constexpr u32            STORE_VERSION  = 1;
+    constexpr u32            FLAG_TOMBSTONE = 1U << 0;
+
+    struct FileHeader {
+      Array<char, 8> magic;
+      u32            version;
+      u32            reserved;
+      u64            end; ///< Offset one past the last committed record.
+    };
+
+    struct RecordHeader {
+      u32 keySize;
+      u32 valueSize;
+      u32 flags;
+      u32 reserved;
+    };
+
+    static_assert(sizeof(FileHeader) == 24);
+    static_assert(sizeof(RecordHeader) == 16);
+
+    template <typename T>
+    fn ReadPod(const StringView bytes, const u64 offset) -> T {
+      T value;
+      std::memcpy(&value, bytes.data() + offset, sizeof(T));
+      return value;
+    }
+
+    template <typename T>
+    fn AsBytes(const T& value) -> StringView {
+      return { reinterpret_cast<const char*>(&value), sizeof(T) }; // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    fn AppendRecord(String& out, const StringView key, const StringView value, const u32 flags) -> Unit {
+      const RecordHeader header {
+        .keySize   = static_cast<u32>(key.size()),
+        .valueSize = static_cast<u32>(value.size()),
+        .flags     = flags,
+        .reserved  = 0,
+      };
+
+      out.append(AsBytes(header));
+      out.append(key);
+      out.append(value);
+    }
+
+    fn MakeHeader(const u64 end) -> FileHeader {
+      return { .magic = STORE_MAGIC, .version = STORE_VERSION, .reserved = 0, .end = end };
+    }
+
+    fn CommittedEnd(const FileHeader& header, const u64 fileSize) -> Option<u64> {
+      if (header.magic != STORE_MAGIC || header.version != STORE_VERSION)
+        return None;
+
+      if (header.end < sizeof(FileHeader) || header.end > fileSize)
+        return None;
+
+      return header.end;
+    }
+  } // namespace
+
+  CacheStore::CacheStore(fs::path path) : m_path(std::move(path)) {}
+
+  CacheStore::~CacheStore() {
+    closeFile();
+  }
+
+  fn CacheStore::open(const fs::path& path) -> Result<UniquePointer<CacheStore>> {
+    UniquePointer<CacheStore> store(new CacheStore(path));
+
+    if (Result<> res = store->openFile(); !res)
+      ERR_FROM(res.error());
+
+    return store;
+  }
+
+  fn CacheStore::get(const StringView key) -> Option<String> {
+    LockGuard lock(m_mutex);
+
+    auto iter = m_index.find(String(key));
+
+    if (iter == m_index.end()) {
+      // Another process may have stored the key (or compacted the file) since we mapped it.
+      lockFile();
+      const Result<> refreshed = refreshLocked();
+      unlockFile();
+
+      if (!refreshed) {
+        debug_at(refreshed.error());
+        return None;
+      }
+
+      iter = m_index.find(String(key));
+
+      if (iter == m_index.end())
+        return None;
+    }
+
+    return String(m_view.substr(iter->second.offset, iter->second.valueSize));
+  }
+
+  fn CacheStore::put(const StringView key, const StringView value) -> Result<> {
+    String record;
+    record.reserve(sizeof(RecordHeader) + key.size() + value.size());
+    AppendRecord(record, key, value, 0);
+
+    LockGuard lock(m_mutex);
+    return appendRecords(record);
+  }
+
+  fn CacheStore::putMany(const Span<const Pair<StringView, StringView>> entries) -> Result<> {
+    if (entries.empty())
+      return {};
+
+    String records;
+
+    for (const auto& [key, value] : entries)
+      AppendRecord(records, key, value, 0);
+
+    LockGuard lock(m_mutex);
+    return appendRecords(records);
+  }
+
+  fn CacheStore::erase(const StringView key) -> Result<> {
+    LockGuard lock(m_mutex);
+
+    if (!m_index.contains(String(key)))
+      return {};
+
+    String record;
+    AppendRecord(record, key, {}, FLAG_TOMBSTONE);
+
+    return appendRecords(record);
+  }
+
+  fn CacheStore::compact() -> Result<> {
+    LockGuard lock(m_mutex);
+
+    lockFile();
+
+    Result<> result = refreshLocked();
+
+    if (result)
+      result = compactLocked();
+
+    unlockFile();
+
+    return result;
+  }
+
+  fn CacheStore::openFile() -> Result<> {
+    std::error_code errc;
+    fs::create_directories(m_path.parent_path(), errc);
+
+#ifdef _WIN32
+    if (std::ifstream ifs(m_path, std::ios::binary); ifs)
+      m_buffer.assign(std::istreambuf_iterator<char>(ifs), {});
+#else
+    // Another process may replace the file (on a reset or compaction) between
+    // our open() and taking the lock, leaving us locking an orphaned inode.
+    // Retry until the locked descriptor is still the file at m_path.
+    while (true) {
+      m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+
+      if (m_fd < 0)
+        ERR_FMT(IoError, "Failed to open cache store {}: {}", m_path.string(), std::strerror(errno));
+
+      struct stat fileStat {};
+
+      if (fstat(m_fd, &fileStat) != 0) {
+        const i32 err = errno;
+        closeFile();
+        ERR_FMT(IoError, "Failed to stat cache store {}: {}", m_path.string(), std::strerror(err));
+      }
+
+      m_device = static_cast<u64>(fileStat.st_dev);
+      m_inode  = static_cast<u64>(fileStat.st_ino);
+
+      lockFile();
+
+      if (isCurrentFile())
+        break;
+
+      unlockFile();
+      closeFile();
+    }
+#endif
+
+    Result<> result = [&]() -> Result<> {
+      const Option<u64> end = readCommittedEnd();
+
+      if (!end)
+        return resetLocked();
+
+      if (Result<> res = remap(*end); !res)
+        return res;
+
+      if (Result<> res = scan(sizeof(FileHeader), *end); !res) {
+        debug_at(res.error());
+        return resetLocked();
+      }
+
+      return {};
+    }();
+
+    unlockFile();
+
+    return result;
+  }
+
+  fn CacheStore::closeFile() -> Unit {
+    m_view = {};
+
+#ifdef _WIN32
+    m_buffer.clear();
+#else
+    if (m_map != nullptr)
+      munmap(m_map, m_mapSize);
+
+    if (m_fd >= 0)
+      ::close(m_fd);
+
+    m_map     = nullptr;
+    m_mapSize = 0;
+    m_fd      = -1;
+#endif
+  }
+
+  fn CacheStore::readCommittedEnd() const -> Option<u64> {
+#ifdef _WIN32
+    if (m_buffer.size() < sizeof(FileHeader))
+      return None;
+
+    return CommittedEnd(ReadPod<FileHeader>(m_buffer, 0), m_buffer.size());
+#else
+    FileHeader  header {};
+    struct stat fileStat {};
+
+    if (pread(m_fd, &header, sizeof(header), 0) != static_cast<isize>(sizeof(header)) || fstat(m_fd, &fileStat) != 0)
+      return None;
+
+    return CommittedEnd(header, static_cast<u64>(fileStat.st_size));
+#endif
+  }
+
+  fn CacheStore::resetLocked() -> Result<> {
+    m_index.clear();
+    m_liveBytes = 0;
+    m_deadBytes = 0;
+    m_view      = {};
+
+#ifdef _WIN32
+    m_buffer.clear();
+
+    if (std::ofstream ofs(m_path, std::ios::binary | std::ios::trunc); !ofs)
+      ERR_FMT(IoError, "Failed to truncate cache store {}", m_path.string());
+
+    if (Result<> res = writeAt(0, AsBytes(MakeHeader(sizeof(FileHeader)))); !res)
+      return res;
+
+    return remap(sizeof(FileHeader));
+#else
+    // Truncating in place would SIGBUS every other process that still has the
+    // file mapped, so swap in an empty store the same way compaction does.
+    return replaceFile(AsBytes(MakeHeader(sizeof(FileHeader))));
+#endif
+  }
+
+  fn CacheStore::remap(const u64 end) -> Result<> {
+#ifdef _WIN32
+    m_view = StringView(m_buffer).substr(0, end);
+#else
+    if (m_map != nullptr)
+      munmap(m_map, m_mapSize);
+
+    m_map     = nullptr;
+    m_mapSize = 0;
+    m_view    = {};
+
+    void* addr = mmap(nullptr, end, PROT_READ, MAP_SHARED, m_fd, 0);
+
+    if (addr == MAP_FAILED)
+      ERR_FMT(IoError, "Failed to map cache store {}: {}", m_path.string(), std::strerror(errno));
+
+    m_map     = addr;
+    m_mapSize = end;
+    m_view    = StringView(static_cast<const char*>(addr), end);
+#endif
+
+    return {};
+  }
+
+  fn CacheStore::scan(const u64 from, const u64 end) -> Result<> {
+    u64 offset = from;
+
+    while (offset < end) {
+      if (end - offset < sizeof(RecordHeader))
+        ERR_FMT(CorruptedData, "Truncated record header at offset {} in {}", offset, m_path.string());
+
+      const auto record     = ReadPod<RecordHeader>(m_view, offset);
+      const u64  recordSize = sizeof(RecordHeader) + static_cast<u64>(record.keySize) + record.valueSize;
+
+      if (end - offset < recordSize)
+        ERR_FMT(CorruptedData, "Truncated record at offset {} in {}", offset, m_path.string());
+
+      String key(m_view.substr(offset + sizeof(RecordHeader), record.keySize));
+
+      if (const auto iter = m_index.find(key); iter != m_index.end()) {
+        m_liveBytes -= iter->second.recordSize;
+        m_deadBytes += iter->second.recordSize;
+      }
+
+      if ((record.flags & FLAG_TOMBSTONE) != 0) {
+        m_index.erase(key);
+        m_deadBytes += recordSize;
+      } else {
+        m_index.insert_or_assign(
+          std::move(key),
+          Slot {
+            .offset     = offset + sizeof(RecordHeader) + record.keySize,
+            .valueSize  = record.valueSize,
+            .recordSize = static_cast<u32>(recordSize),
+          }
+        );
+        m_liveBytes += recordSize;
+      }
+
+      offset += recordSize;
+    }
+
+    return {};
+  }
+
+  fn CacheStore::refreshLocked() -> Result<> {
+#ifndef _WIN32
+    // Another process may have compacted (replaced) or removed the file since we
+    // opened it, in which case our descriptor points at an orphaned inode.
+    if (!isCurrentFile()) {
+      unlockFile();
+      closeFile();
+
+      m_index.clear();
+      m_liveBytes = 0;
+      m_deadBytes = 0;
+
+      if (Result<> res = openFile(); !res)
+        return res;
+
+      lockFile();
+    }
+
+    // Pick up records other processes appended since we last mapped the file.
+    const Option<u64> end = readCommittedEnd();
+
+    if (!end || *end < m_view.size())
+      return resetLocked();
+
+    if (*end > m_view.size()) {
+      const u64 from = m_view.size();
+
+      if (Result<> res = remap(*end); !res)
+        return res;
+
+      if (Result<> res = scan(from, *end); !res) {
+        debug_at(res.error());
+        return resetLocked();
+      }
+    }
+#endif
+
+    return {};
+  }
+
+  fn CacheStore::appendRecords(const StringView records) -> Result<> {
+    lockFile();
+
+    Result<> result = [&]() -> Result<> {
+      if (Result<> res = refreshLocked(); !res)
+        return res;
+
+      const u64 offset = m_view.size();
+      const u64 end    = offset + records.size();
+
+      // Write the records first and only then publish them through the header,
+      // so a reader never sees a partially written record.
+      if (Result<> res = writeAt(offset, records); !res)
+        return res;
+
+      if (Result<> res = writeAt(0, AsBytes(MakeHeader(end))); !res)
+        return res;
+
+      if (Result<> res = remap(end); !res)
+        return res;
+
+      if (Result<> res = scan(offset, end); !res)
+        return res;
+
+      if (m_deadBytes > COMPACT_MIN_DEAD_BYTES && m_deadBytes > m_liveBytes)
+        return compactLocked();
+
+      return {};
+    }();
+
+    unlockFile();
+
+    return result;
+  }
+
+  fn CacheStore::compactLocked() -> Result<> {
+    String contents(sizeof(FileHeader), '\0');
+    contents.reserve(sizeof(FileHeader) + m_liveBytes);
+
+    for (const auto& [key, slot] : m_index) {
+      const RecordHeader header {
+        .keySize   = static_cast<u32>(key.size()),
+        .valueSize = slot.valueSize,
+        .flags     = 0,
+        .reserved  = 0,
+      };
+
+      contents.append(AsBytes(header));
+      contents.append(key);
+      contents.append(m_view.substr(slot.offset, slot.valueSize));
+    }
+
+    const FileHeader header = MakeHeader(contents.size());
+    std::memcpy(contents.data(), &header, sizeof(header));
+
+    return replaceFile(contents);
+  }
+
+  fn CacheStore::replaceFile(const StringView contents) -> Result<> {
+    const fs::path tempPath = fs::path(m_path).concat(".compact");
+
+#ifdef _WIN32
+    {
+      std::ofstream ofs(tempPath, std::ios::binary | std::ios::trunc);
+
+      if (!ofs)
+        ERR_FMT(IoError, "Failed to create {}", tempPath.string());
+
+      ofs.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+      if (!ofs)
+        ERR_FMT(IoError, "Failed to write {}", tempPath.string());
+    }
+#else
+    i32 tempFd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+
+    // Left behind by a writer that died mid-replace; we hold the store's lock, so nobody else is using it.
+    if (tempFd < 0 && errno == EEXIST) {
+      ::unlink(tempPath.c_str());
+      tempFd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    }
+
+    if (tempFd < 0)
+      ERR_FMT(IoError, "Failed to create {}: {}", tempPath.string(), std::strerror(errno));
+
+    usize written = 0;
+
+    while (written < contents.size()) {
+      const isize res = ::write(tempFd, contents.data() + written, contents.size() - written);
+
+      if (res < 0) {
+        if (errno == EINTR)
+          continue;
+
+        const i32 err = errno;
+
+        ::close(tempFd);
+        ::unlink(tempPath.c_str());
+
+        ERR_FMT(IoError, "Failed to write {}: {}", tempPath.string(), std::strerror(err));
+      }
+
+      written += static_cast<usize>(res);
+    }
+
+    ::close(tempFd);
+#endif
+
+    std::error_code errc;
+    fs::rename(tempPath, m_path, errc);
+
+    if (errc) {
+      fs::remove(tempPath, errc);
+      ERR_FMT(IoError, "Failed to replace cache store {}", m_path.string());
+    }
+
+    // Switch over to the new file. Closing the old descriptor releases our lock
+    // on it, so take the lock again on the new one for the caller to release.
+    closeFile();
+
+    m_index.clear();
+    m_liveBytes = 0;
+    m_deadBytes = 0;
+
+    if (Result<> res = openFile(); !res)
+      return res;
+
+    lockFile();
+
+    return {};
+  }
+
+  fn CacheStore::isCurrentFile() const -> bool {
+#ifdef _WIN32
+    return true;
+#else
+    // Inode numbers are only unique per device, and a recreated file may reuse the old one's.
+    struct stat pathStat {};
+    return ::stat(m_path.c_str(), &pathStat) == 0 && static_cast<u64>(pathStat.st_dev) == m_device &&
+      static_cast<u64>(pathStat.st_ino) == m_inode;
+#endif
+  }
+
+  fn CacheStore::writeAt(const u64 offset, const StringView bytes) -> Result<> {
+#ifdef _WIN32
+    if (m_buffer.size() < offset + bytes.size())
+      m_buffer.resize(offset + bytes.size());
+
+    std::memcpy(m_buffer.data() + offset, bytes.data(), bytes.size());
+
+    std::fstream file(m_path, std::ios::in | std::ios::out | std::ios::binary);
+
+    if (!file)
+      ERR_FMT(IoError, "Failed to open cache store {} for writing", m_path.string());
+
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+    if (!file)
+      ERR_FMT(IoError, "Failed to write cache store {}", m_path.string());
+#else
+    usize written = 0;
+
+    while (written < bytes.size()) {
+      const isize res = pwrite(m_fd, bytes.data() + written, bytes.size() - written, static_cast<off_t>(offset + written));
+
+      if (res < 0) {
+        if (errno == EINTR)
+          continue;
+
+        ERR_FMT(IoError, "Failed to write cache store {}: {}", m_path.string(), std::strerror(errno));
+      }
+
+      written += static_cast<usize>(res);
+    }
+#endif
+
+    return {};
+  }
+
+  fn CacheStore::lockFile() -> Unit {
+#ifndef _WIN32
+    while (flock(m_fd, LOCK_EX) != 0 && errno == EINTR);
+#endif
+  }
+
+  fn CacheStore::unlockFile() -> Unit {
+#ifndef _WIN32
+    flock(m_fd, LOCK_UN);
+#endif
+  }
+} // namespace draconis::utils::cache
@@ -2,7 +2,7 @@
 
   #include <algorithm>
   #include <arpa/inet.h>          // inet_ntop
-  #include <chrono>               // std::chrono::minutes
+  #include <chrono>               // std::chrono::{days, seconds}
   #include <cpuid.h>              // __get_cpuid
   #include <cstring>              // std::strlen
   #include <expected>             // std::{unexpected, expected}
@@ -12,16 +12,12 @@
   #include <fstream>              // std::ifstream
   #include <glaze/beve/read.hpp>  // glz::read_beve
   #include <glaze/beve/write.hpp> // glz::write_beve
-  #include <ifaddrs.h>            // getifaddrs, freeifaddrs, ifaddrs
-  #include <linux/if_packet.h>    // sockaddr_ll
   #include <linux/limits.h>       // PATH_MAX
   #include <map>                  // std::map
   #include <matchit.hpp>          // matchit::{is, is_not, is_any, etc.}
-  #include <net/if.h>             // IFF_UP, IFF_LOOPBACK
-  #include <netdb.h>              // getnameinfo, NI_NUMERICHOST
-  #include <netinet/in.h>         // sockaddr_in
-  #include <ranges>               // std::views::{common, split, values}
-  #include <sstream>              // std::istringstream
+  #include <net/if.h>             // IFF_UP, IFF_LOOPBACK, IFF_RUNNING
+  #include <netinet/in.h>         // INET6_ADDRSTRLEN
+  #include <ranges>               // std::views::values
   #include <string>               // std::{getline, string (String)}
   #include <string_view>          // std::string_view (StringView)
   #include <sys/mman.h>           // mmap, munmap
@@ -43,6 +39,10 @@
   #include "Drac++/Utils/Logging.hpp"
   #include "Drac++/Utils/Types.hpp"
 
+  #include "OS/Linux/Netlink.hpp"
+  #include "OS/Linux/SysFs.hpp"
+  #include "OS/PciIds.hpp"
+  #include "OS/Readouts.hpp"
   #include "Wrappers/DBus.hpp"
   #include "Wrappers/Wayland.hpp"
   #include "Wrappers/XCB.hpp"
@@ -59,83 +59,39 @@ extern "C" fn issetugid() -> usize { return 0; } // NOLINT(readability-identifie
 // clang-format on
 
 namespace {
-  template <std::integral T>
-  constexpr fn TryParse(StringView sview) -> Option<T> {
-    T value;
+  namespace netlink = draconis::core::system::linux::netlink;
+  namespace pci     = draconis::core::system::pci;
 
-    auto [ptr, ec] = std::from_chars(sview.begin(), sview.end(), value);
+  using draconis::core::system::linux::sysfs::Directory;
+  using draconis::core::system::linux::sysfs::FileBuffer;
 
-    if (ec == std::errc() && ptr == sview.end())
-      return value;
+  /*
+   * Directories that readouts keep coming back to. They're opened on first use
+   * and kept for the life of the process, so each read is one openat() and one
+   * pread() with no path building.
+   */
 
-    return None;
+  fn EtcDirectory() -> const Directory& {
+    static const Directory directory("/etc");
+    return directory;
   }
 
-  fn ReadSysFile(const fs::path& path) -> Result<String> {
-    std::ifstream file(path);
-    if (!file.is_open())
-      ERR_FMT(NotFound, "Failed to open sysfs file: {}", path.string());
-
-    String line;
-
-    if (std::getline(file, line)) {
-      if (const usize pos = line.find_last_not_of(" \t\n\r"); pos != String::npos)
-        line.erase(pos + 1);
-
-      return line;
-    }
-
-    ERR_FMT(IoError, "Failed to read from sysfs file: {}", path.string());
+  fn DmiDirectory() -> const Directory& {
+    static const Directory directory("/sys/class/dmi/id");
+    return directory;
   }
 
-  fn LookupPciNamesFromBuffer(StringView buffer, const StringView vendorId, const StringView deviceId) -> Result<Pair<String, String>> {
-    using std::views::common;
-    using std::views::split;
-
-    const StringView vendorIdStr = vendorId.starts_with("0x") ? vendorId.substr(2) : vendorId;
-    const StringView deviceIdStr = deviceId.starts_with("0x") ? deviceId.substr(2) : deviceId;
-
-    bool       vendorFound       = false;
-    StringView currentVendorName = {};
-
-    for (auto lineRange : buffer | split('\n') | common) {
-      StringView line(&*lineRange.begin(), lineRange.size());
-
-      if (line.empty() || line.front() == '#')
-        continue;
-
-      if (line.front() != '\t') {
-        vendorFound = false;
-
-        if (line.starts_with(vendorIdStr)) {
-          vendorFound = true;
-          if (const usize namePos = line.find("  "); namePos != String::npos)
-            currentVendorName = line.substr(namePos + 2);
-        }
-      } else if (vendorFound && line.size() > 1 && line[1] != '\t') {
-        const StringView deviceLine = line.substr(1); // skip leading tab
-
-        if (deviceLine.starts_with(deviceIdStr))
-          if (const usize namePos = line.find("  "); namePos != String::npos)
-            return Pair(String(currentVendorName), String(line.substr(namePos + 2)));
-      }
-    }
-
-    ERR_FMT(NotFound, "PCI device with vendor ID '{}' and device ID '{}' not found in PCI IDs buffer", vendorId, deviceId);
+  fn PciDevicesDirectory() -> const Directory& {
+    static const Directory directory("/sys/bus/pci/devices");
+    return directory;
   }
 
-  #if DRAC_USE_LINKED_PCI_IDS
-  extern "C" {
-    extern const char _binary_pci_ids_start[];
-    extern const char _binary_pci_ids_end[];
+  fn PowerSupplyDirectory() -> const Directory& {
+    static const Directory directory("/sys/class/power_supply");
+    return directory;
   }
 
-  fn LookupPciNames(const StringView vendorId, const StringView deviceId) -> Result<Pair<String, String>> {
-    const usize pciIdsLen = _binary_pci_ids_end - _binary_pci_ids_start;
-
-    return LookupPciNamesFromBuffer(StringView(_binary_pci_ids_start, pciIdsLen), vendorId, deviceId);
-  }
-  #else
+  #if !DRAC_USE_LINKED_PCI_IDS
   fn FindPciIDsPath() -> fs::path {
     const Array<fs::path, 3> knownPaths = {
       "/usr/share/hwdata/pci.ids",
@@ -150,12 +106,7 @@ namespace {
     return {};
   }
 
-  fn LookupPciNames(const StringView vendorId, const StringView deviceId) -> Result<Pair<String, String>> {
-    const fs::path& pciIdsPath = FindPciIDsPath();
-
-    if (pciIdsPath.empty())
-      ERR(NotFound, "Could not find pci.ids");
-
+  fn BuildPciIdsIndexFromFile(const fs::path& pciIdsPath) -> Result<String> {
     const i32 filedesc = open(pciIdsPath.c_str(), O_RDONLY | O_CLOEXEC);
 
     if (filedesc >= 0) {
@@ -165,16 +116,12 @@ namespace {
         RawPointer mapped = mmap(nullptr, statbuf.st_size, PROT_READ, MAP_PRIVATE, filedesc, 0);
 
         if (mapped != MAP_FAILED) {
-          Result<Pair<String, String>> result = LookupPciNamesFromBuffer(
-            StringView(static_cast<PCStr>(mapped), static_cast<usize>(statbuf.st_size)),
-            vendorId,
-            deviceId
-          );
+          Result<String> index = pci::BuildIndex(StringView(static_cast<PCStr>(mapped), static_cast<usize>(statbuf.st_size)));
 
           munmap(mapped, statbuf.st_size);
           close(filedesc);
 
-          return result;
+          return index;
         }
       }
 
@@ -188,7 +135,7 @@ namespace {
 
     std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
 
-    return LookupPciNamesFromBuffer(StringView(contents), vendorId, deviceId);
+    return pci::BuildIndex(contents);
   }
   #endif
 
@@ -216,15 +163,17 @@ namespace {
   }
 
   #if DRAC_USE_XCB
-  fn GetX11WindowManager() -> Result<String> {
+  using X11Connection = SharedPointer<XCB::DisplayGuard>;
+
+  fn ConnectX11() -> Result<X11Connection> {
     using namespace XCB;
     using namespace matchit;
     using enum ConnError;
 
-    const DisplayGuard conn;
+    auto conn = std::make_shared<DisplayGuard>();
 
-    if (!conn)
-      if (const i32 err = ConnectionHasError(conn.get()))
+    if (!*conn) {
+      if (const i32 err = ConnectionHasError(conn->get()))
         ERR(
           ApiUnavailable,
           match(err)(
@@ -239,6 +188,17 @@ namespace {
           )
         );
 
+      ERR(ApiUnavailable, "Failed to connect to X server");
+    }
+
+    return conn;
+  }
+
+  fn GetX11WindowManager(const X11Connection& connection) -> Result<String> {
+    using namespace XCB;
+
+    const DisplayGuard& conn = *connection;
+
     const fn internAtom = [&conn](const StringView name) -> Result<Atom> {
       const ReplyGuard<IntAtomReply> reply(InternAtomReply(conn.get(), InternAtom(conn.get(), 0, static_cast<u16>(name.size()), name.data()), nullptr));
 
@@ -300,12 +260,10 @@ namespace {
     return String(nameData, length);
   }
 
-  fn GetX11Displays() -> Result<Vec<DisplayInfo>> {
+  fn GetX11Displays(const X11Connection& connection) -> Result<Vec<DisplayInfo>> {
     using namespace XCB;
 
-    DisplayGuard conn;
-    if (!conn)
-      ERR(ApiUnavailable, "Failed to connect to X server");
+    const DisplayGuard& conn = *connection;
 
     const Setup* setup = conn.setup();
     if (!setup)
@@ -398,12 +356,10 @@ namespace {
     return displays;
   }
 
-  fn GetX11PrimaryDisplay() -> Result<DisplayInfo> {
+  fn GetX11PrimaryDisplay(const X11Connection& connection) -> Result<DisplayInfo> {
     using namespace XCB;
 
-    DisplayGuard conn;
-    if (!conn)
-      ERR(ApiUnavailable, "Failed to connect to X server");
+    const DisplayGuard& conn = *connection;
 
     Screen* screen = conn.rootScreen();
     if (!screen)
@@ -462,26 +418,40 @@ namespace {
     );
   }
   #else
-  fn GetX11WindowManager() -> Result<String> {
+  using X11Connection = SharedPointer<Unit>; // Never created; ConnectX11() always fails.
+
+  fn ConnectX11() -> Result<X11Connection> {
+    ERR(NotSupported, "XCB (X11) support not available");
+  }
+
+  fn GetX11WindowManager(const X11Connection& /*connection*/) -> Result<String> {
     ERR(NotSupported, "XCB (X11) support not available");
   }
 
-  fn GetX11Displays() -> Result<Vec<DisplayInfo>> {
+  fn GetX11Displays(const X11Connection& /*connection*/) -> Result<Vec<DisplayInfo>> {
     ERR(NotSupported, "XCB (X11) support not available");
   }
 
-  fn GetX11PrimaryDisplay() -> Result<DisplayInfo> {
+  fn GetX11PrimaryDisplay(const X11Connection& /*connection*/) -> Result<DisplayInfo> {
     ERR(NotSupported, "XCB (X11) support not available");
   }
   #endif
 
   #if DRAC_USE_WAYLAND
-  fn GetWaylandCompositor() -> Result<String> {
-    const Wayland::DisplayGuard display;
+  using WaylandConnection = SharedPointer<Wayland::DisplayGuard>;
 
-    if (!display)
+  fn ConnectWayland() -> Result<WaylandConnection> {
+    auto display = std::make_shared<Wayland::DisplayGuard>();
+
+    if (!*display)
       ERR(ApiUnavailable, "Failed to connect to display (is Wayland running?)");
 
+    return display;
+  }
+
+  fn GetWaylandCompositor(const WaylandConnection& connection) -> Result<String> {
+    const Wayland::DisplayGuard& display = *connection;
+
     const i32 fileDescriptor = display.fd();
     if (fileDescriptor < 0)
       ERR(ApiUnavailable, "Failed to get Wayland file descriptor");
@@ -547,22 +517,13 @@ namespace {
     return String(compositorNameView);
   }
 
-  fn GetWaylandDisplays() -> Result<Vec<DisplayInfo>> {
-    const Wayland::DisplayGuard display;
-    if (!display)
-      ERR(ApiUnavailable, "Failed to connect to Wayland display");
-
-    Wayland::DisplayManager manager(display.get());
+  fn GetWaylandDisplays(const WaylandConnection& connection) -> Result<Vec<DisplayInfo>> {
+    Wayland::DisplayManager manager(connection->get());
     return manager.getOutputs();
   }
 
-  fn GetWaylandPrimaryDisplay() -> Result<DisplayInfo> {
-    const Wayland::DisplayGuard display;
-
-    if (!display)
-      ERR(ApiUnavailable, "Failed to connect to Wayland display");
-
-    Wayland::DisplayManager manager(display.get());
+  fn GetWaylandPrimaryDisplay(const WaylandConnection& connection) -> Result<DisplayInfo> {
+    Wayland::DisplayManager manager(connection->get());
     DisplayInfo             primaryDisplay = manager.getPrimary();
 
     if (primaryDisplay.resolution.width == 0 && primaryDisplay.resolution.height == 0)
@@ -571,174 +532,463 @@ namespace {
     return primaryDisplay;
   }
   #else
-  fn GetWaylandCompositor() -> Result<String> {
+  using WaylandConnection = SharedPointer<Unit>; // Never created; ConnectWayland() always fails.
+
+  fn ConnectWayland() -> Result<WaylandConnection> {
     ERR(NotSupported, "Wayland support not available");
   }
 
-  fn GetWaylandDisplays() -> Result<Vec<DisplayInfo>> {
+  fn GetWaylandCompositor(const WaylandConnection& /*connection*/) -> Result<String> {
     ERR(NotSupported, "Wayland support not available");
   }
 
-  fn GetWaylandPrimaryDisplay() -> Result<DisplayInfo> {
+  fn GetWaylandDisplays(const WaylandConnection& /*connection*/) -> Result<Vec<DisplayInfo>> {
+    ERR(NotSupported, "Wayland support not available");
+  }
+
+  fn GetWaylandPrimaryDisplay(const WaylandConnection& /*connection*/) -> Result<DisplayInfo> {
     ERR(NotSupported, "Wayland support not available");
   }
   #endif
 
-  fn CollectNetworkInterfaces() -> Result<Map<String, NetworkInterface>> {
-    ifaddrs* ifaddrList = nullptr;
-    if (getifaddrs(&ifaddrList) == -1)
-      ERR_FMT(InternalError, "getifaddrs failed: {}", strerror(errno));
+  /**
+   * @brief Interfaces by name, and the one the default route goes through.
+   */
+  struct NetworkSnapshot {
+    Map<String, NetworkInterface> interfaces;
+    Option<String>                defaultRouteInterface;
+  };
+
+  fn FormatMacAddress(const Span<const char> address) -> Option<String> {
+    if (address.size() != 6)
+      return None;
+
+    return std::format(
+      "{:02x}:{:02x}:{:02x}:{:02x}:{:02x}:{:02x}",
+      static_cast<u8>(address[0]),
+      static_cast<u8>(address[1]),
+      static_cast<u8>(address[2]),
+      static_cast<u8>(address[3]),
+      static_cast<u8>(address[4]),
+      static_cast<u8>(address[5])
+    );
+  }
 
-    // Ensure we free the list when we're done
-    UniquePointer<ifaddrs, decltype(&freeifaddrs)> ifaddrsDeleter(ifaddrList, &freeifaddrs);
+  /**
+   * @brief Reads every interface, its addresses, and the default route.
+   *
+   * @details Three rtnetlink dumps (links, addresses, routes) on one socket,
+   * parsed in place; see Netlink.hpp. Cost grows with the number of links
+   * but stays a handful of syscalls, which matters on container hosts with
+   * hundreds of veth interfaces.
+   */
+  fn CollectNetworkSnapshot() -> Result<NetworkSnapshot> {
+    Result<netlink::Socket> socket = netlink::Socket::open();
+
+    if (!socket)
+      ERR_FROM(socket.error());
+
+    netlink::ReceiveBuffer              buffer;
+    UnorderedMap<i32, NetworkInterface> byIndex;
+
+    Result<> links = socket->dump(RTM_GETLINK, AF_UNSPEC, buffer, [&byIndex](const netlink::Message& message) {
+      const Option<netlink::Link> link = netlink::ParseLink(message);
+
+      if (!link)
+        return;
+
+      NetworkInterface& interface = byIndex[link->index];
+
+      interface.name       = link->name;
+      interface.isUp       = link->flags & IFF_UP;
+      interface.isLoopback = link->flags & IFF_LOOPBACK;
+      interface.isRunning  = link->flags & IFF_RUNNING;
+      interface.macAddress = FormatMacAddress(link->hardwareAddress);
+      interface.mtu        = link->mtu;
+    });
 
-    Map<String, NetworkInterface> interfaceMap;
+    if (!links)
+      ERR_FROM(links.error());
 
-    for (ifaddrs* ifa = ifaddrList; ifa != nullptr; ifa = ifa->ifa_next) {
-      using matchit::match, matchit::is, matchit::_;
+    if (byIndex.empty())
+      ERR(NotFound, "No network interfaces found");
 
-      if (ifa->ifa_addr == nullptr)
-        continue;
+    // The RT_SCOPE_* of each IPv6 address, in the same order as the interface's ipv6Addresses.
+    UnorderedMap<i32, Vec<u8>> ipv6Scopes;
 
-      NetworkInterface& interface = interfaceMap[ifa->ifa_name];
-      interface.name              = ifa->ifa_name;
-
-      interface.isUp       = ifa->ifa_flags & IFF_UP;
-      interface.isLoopback = ifa->ifa_flags & IFF_LOOPBACK;
-
-      match(ifa->ifa_addr->sa_family)(
-        is | AF_INET = [&]() { // IPv4
-          Array<char, NI_MAXHOST> host = {};
-          if (getnameinfo(ifa->ifa_addr, sizeof(sockaddr_in), host.data(), host.size(), nullptr, 0, NI_NUMERICHOST) == 0)
-            interface.ipv4Address = { host.data() };
-        },
-        is | AF_INET6 = [&]() { // IPv6
-          Array<char, NI_MAXHOST> host = {};
-          if (getnameinfo(ifa->ifa_addr, sizeof(sockaddr_in6), host.data(), host.size(), nullptr, 0, NI_NUMERICHOST) == 0)
-            interface.ipv6Address = { host.data() };
-        },
-        is | AF_PACKET = [&]() { // MAC address
-          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-          auto* sll = reinterpret_cast<sockaddr_ll*>(ifa->ifa_addr);
-
-          if (sll && sll->sll_halen == 6)
-            interface.macAddress = std::format(
-              "{:02x}:{:02x}:{:02x}:{:02x}:{:02x}:{:02x}",
-              sll->sll_addr[0],
-              sll->sll_addr[1],
-              sll->sll_addr[2],
-              sll->sll_addr[3],
-              sll->sll_addr[4],
-              sll->sll_addr[5]
-            );
-        },
-        is | _ = [&]() { return; }
-      );
-    }
+    Result<> addresses = socket->dump(RTM_GETADDR, AF_UNSPEC, buffer, [&byIndex, &ipv6Scopes](const netlink::Message& message) {
+      const Option<netlink::Address> address = netlink::ParseAddress(message);
 
-    if (interfaceMap.empty())
-      ERR(NotFound, "No network interfaces found");
+      if (!address || (address->family != AF_INET && address->family != AF_INET6))
+        return;
 
-    return interfaceMap;
-  }
-} // namespace
+      const auto iter = byIndex.find(address->index);
 
-namespace draconis::core::system {
-  using draconis::utils::cache::CacheManager;
-  using draconis::utils::env::GetEnv;
+      if (iter == byIndex.end() || address->address.size() != (address->family == AF_INET ? 4 : 16))
+        return;
 
-  namespace linux {
-    fn GetDistroID(CacheManager& cache) -> Result<String> {
-      return cache.getOrSet<String>("linux_distro_id", []() -> Result<String> {
-        std::ifstream file("/etc/os-release");
+      Array<char, INET6_ADDRSTRLEN> text = {};
 
-        if (!file.is_open())
-          ERR(NotFound, "Failed to open /etc/os-release");
+      if (inet_ntop(address->family, address->address.data(), text.data(), text.size()) == nullptr)
+        return;
 
-        String line;
+      if (address->family == AF_INET) {
+        iter->second.ipv4Addresses.emplace_back(text.data());
+      } else {
+        iter->second.ipv6Addresses.emplace_back(text.data());
+        ipv6Scopes[address->index].push_back(address->scope);
+      }
+    });
 
-        while (std::getline(file, line)) {
-          if (StringView(line).starts_with("ID=")) {
-            String value = line.substr(3);
+    if (!addresses)
+      ERR_FROM(addresses.error());
 
-            if ((value.length() >= 2 && value.front() == '"' && value.back() == '"') ||
-                (value.length() >= 2 && value.front() == '\'' && value.back() == '\''))
-              value = value.substr(1, value.length() - 2);
+    // IPv4 first, as the primary interface has always been picked by it, then the lowest metric.
+    Option<netlink::Route> defaultRoute;
 
-            if (value.empty())
-              ERR(ParseError, "ID value is empty or only quotes in /etc/os-release");
+    Result<> routes = socket->dump(RTM_GETROUTE, AF_UNSPEC, buffer, [&defaultRoute](const netlink::Message& message) {
+      const Option<netlink::Route> route = netlink::ParseDefaultRoute(message);
 
-            return String(value);
-          }
-        }
+      const fn rank = [](const netlink::Route& candidate) { return Pair(candidate.family != AF_INET, candidate.priority); };
 
-        ERR(NotFound, "ID line not found in /etc/os-release");
-      });
-    }
-  } // namespace linux
+      if (route && (!defaultRoute || rank(*route) < rank(*defaultRoute)))
+        defaultRoute = route;
+    });
 
-  fn GetOperatingSystem(CacheManager& cache) -> Result<OSInfo> {
-    return cache.getOrSet<OSInfo>("linux_os_version", []() -> Result<OSInfo> {
-      std::ifstream file("/etc/os-release");
+    if (!routes)
+      ERR_FROM(routes.error());
 
-      if (!file.is_open())
-        ERR(NotFound, "Failed to open /etc/os-release");
-
-      String osName, osVersion, osId;
-
-      String line;
-
-      const fn parseValue = [&](String& val) {
-        if (val.length() >= 2 && ((val.front() == '"' && val.back() == '"') || (val.front() == '\'' && val.back() == '\'')))
-          val = val.substr(1, val.length() - 2);
-      };
-
-      while (std::getline(file, line)) {
-        const StringView lineView = line;
-
-        if (lineView.starts_with("NAME=")) {
-          osName = lineView.substr(5);
-          parseValue(osName);
-        } else if (lineView.starts_with("VERSION=")) {
-          osVersion = lineView.substr(8);
-          parseValue(osVersion);
-        } else if (lineView.starts_with("ID=")) {
-          osId = lineView.substr(3);
-          parseValue(osId);
-        } else if (lineView.starts_with("PRETTY_NAME=") && osName.empty()) {
-          osName = lineView.substr(12);
-          parseValue(osName);
-        } else if (lineView.starts_with("VERSION_ID=") && osVersion.empty()) {
-          osVersion = lineView.substr(11);
-          parseValue(osVersion);
-        }
+    NetworkSnapshot snapshot;
+
+    if (defaultRoute)
+      if (const auto iter = byIndex.find(defaultRoute->outputIndex); iter != byIndex.end())
+        snapshot.defaultRouteInterface = iter->second.name;
+
+    for (auto& [index, interface] : byIndex) {
+      if (!interface.ipv4Addresses.empty())
+        interface.ipv4Address = interface.ipv4Addresses.front();
+
+      // Every IPv6 interface has a link-local address; a wider-scoped one is more useful when there is one.
+      if (!interface.ipv6Addresses.empty()) {
+        const Vec<u8>& scopes = ipv6Scopes[index];
+        const auto     wider  = std::ranges::find_if(scopes, [](const u8 scope) { return scope != RT_SCOPE_LINK; });
+
+        interface.ipv6Address = interface.ipv6Addresses.at(wider == scopes.end() ? 0 : static_cast<usize>(wider - scopes.begin()));
       }
 
-      if (osId.empty())
-        ERR(NotFound, "ID not found in /etc/os-release");
+      String name = interface.name;
+      snapshot.interfaces.emplace(std::move(name), std::move(interface));
+    }
 
-      if (osName.empty())
-        ERR(NotFound, "NAME or PRETTY_NAME not found in /etc/os-release");
+    return snapshot;
+  }
 
-      if (osVersion.empty())
-        osVersion = "";
+  fn InterfaceListFrom(const NetworkSnapshot& snapshot) -> Vec<NetworkInterface> {
+    Vec<NetworkInterface> interfaces;
+    interfaces.reserve(snapshot.interfaces.size());
 
-      return OSInfo(osName, osVersion, osId);
-    });
+    std::ranges::copy(snapshot.interfaces | std::views::values, std::back_inserter(interfaces));
+
+    return interfaces;
   }
 
-  fn GetMemInfo(CacheManager& /*cache*/) -> Result<ResourceUsage> {
-    struct sysinfo info;
+  fn PrimaryInterfaceFrom(const NetworkSnapshot& snapshot) -> Result<NetworkInterface> {
+    const Map<String, NetworkInterface>& interfaces = snapshot.interfaces;
+
+    // The interface the default route goes through, if there is one
+    String primaryInterfaceName = snapshot.defaultRouteInterface.value_or("");
+
+    // Fallback: first non-loopback interface that is up (Ranges style)
+    if (primaryInterfaceName.empty())
+      if (auto iter = std::ranges::find_if(
+            interfaces,
+            [](const auto& pair) {
+              const auto& iface = pair.second;
+              return iface.isUp && !iface.isLoopback;
+            }
+          );
+          iter != interfaces.end()) {
+        primaryInterfaceName = iter->first;
+      }
+
+    if (primaryInterfaceName.empty())
+      ERR(NotFound, "Could not determine primary interface name");
+
+    const auto iter = interfaces.find(primaryInterfaceName);
+    if (iter == interfaces.end())
+      ERR(NotFound, "Found primary interface name, but could not find its details");
+
+    return iter->second;
+  }
+
+  using SysInfo = struct sysinfo;
+
+  // Memory and uptime both come from here.
+  fn ReadSysinfo() -> Result<SysInfo> {
+    SysInfo info;
 
     if (sysinfo(&info) != 0)
       ERR(ApiUnavailable, "sysinfo call failed");
 
+    return info;
+  }
+
+  fn MemInfoFrom(const SysInfo& info) -> Result<ResourceUsage> {
     if (info.mem_unit == 0)
       ERR(PlatformSpecific, "sysinfo.mem_unit is 0, cannot calculate memory");
 
     return ResourceUsage((info.totalram - info.freeram - info.bufferram) * info.mem_unit, info.totalram * info.mem_unit);
   }
 
+  fn UptimeFrom(const Result<SysInfo>& info) -> Result<std::chrono::seconds> {
+    // Memory info reports a failed sysinfo() as ApiUnavailable, but uptime always used InternalError.
+    if (!info)
+      ERR(InternalError, "sysinfo call failed");
+
+    return std::chrono::seconds(info->uptime);
+  }
+
+  /**
+   * @brief The fields of /etc/os-release that the OS and distro ID readouts use, with quotes stripped.
+   */
+  struct OsRelease {
+    String         name, prettyName, version, versionId;
+    Option<String> id; ///< None if there's no ID= line at all.
+  };
+
+  fn ReadOsRelease() -> Result<OsRelease> {
+    const fn unquote = [](StringView val) -> String {
+      if (val.length() >= 2 && ((val.front() == '"' && val.back() == '"') || (val.front() == '\'' && val.back() == '\'')))
+        val = val.substr(1, val.length() - 2);
+
+      return String(val);
+    };
+
+    OsRelease release;
+
+    Result<> parsed = EtcDirectory().forEachLine("os-release", [&](const StringView line) -> bool {
+      if (line.starts_with("NAME="))
+        release.name = unquote(line.substr(5));
+      else if (line.starts_with("VERSION="))
+        release.version = unquote(line.substr(8));
+      else if (line.starts_with("ID=") && !release.id)
+        release.id = unquote(line.substr(3));
+      else if (line.starts_with("PRETTY_NAME="))
+        release.prettyName = unquote(line.substr(12));
+      else if (line.starts_with("VERSION_ID="))
+        release.versionId = unquote(line.substr(11));
+
+      return false;
+    });
+
+    if (!parsed)
+      ERR_FROM(parsed.error());
+
+    return release;
+  }
+
+  fn OSInfoFrom(const OsRelease& release) -> Result<OSInfo> {
+    if (!release.id || release.id->empty())
+      ERR(NotFound, "ID not found in /etc/os-release");
+
+    const String& name = release.name.empty() ? release.prettyName : release.name;
+
+    if (name.empty())
+      ERR(NotFound, "NAME or PRETTY_NAME not found in /etc/os-release");
+
+    return OSInfo(name, release.version.empty() ? release.versionId : release.version, *release.id);
+  }
+
+  fn DistroIDFrom(const OsRelease& release) -> Result<String> {
+    if (!release.id)
+      ERR(NotFound, "ID line not found in /etc/os-release");
+
+    if (release.id->empty())
+      ERR(ParseError, "ID value is empty or only quotes in /etc/os-release");
+
+    return *release.id;
+  }
+
+  /**
+   * @brief Display server connections shared by the window manager and output readouts.
+   *
+   * @details Each connection is only opened if a readout asks for it, and at
+   * most once until close().
+   */
+  struct DisplayConnections {
+    draconis::core::system::detail::SharedSource<X11Connection>     x11 { ConnectX11 };
+    draconis::core::system::detail::SharedSource<WaylandConnection> wayland { ConnectWayland };
+
+    fn close() -> Unit {
+      x11.close();
+      wayland.close();
+    }
+  };
+
+  fn WindowManagerFrom(DisplayConnections& connections) -> Result<String> {
+    if (GetEnv("WAYLAND_DISPLAY")) {
+      Result<WaylandConnection> connection = connections.wayland.get();
+
+      if (!connection)
+        ERR_FROM(connection.error());
+
+      return GetWaylandCompositor(*connection);
+    }
+
+    if (GetEnv("DISPLAY")) {
+      Result<X11Connection> connection = connections.x11.get();
+
+      if (!connection)
+        ERR_FROM(connection.error());
+
+      return GetX11WindowManager(*connection);
+    }
+
+    ERR(NotFound, "No display server detected");
+  }
+
+  /**
+   * @brief Asks Wayland, then X11, for a display readout, using whichever server is detected.
+   */
+  template <typename T>
+  fn FromDisplayServer(
+    DisplayConnections& connections,
+    const Fn<Result<T>(const WaylandConnection&)>& fromWayland,
+    const Fn<Result<T>(const X11Connection&)>& fromX11
+  ) -> Result<T> {
+    if (GetEnv("WAYLAND_DISPLAY")) {
+      Result<T> result = connections.wayland.get().and_then(fromWayland);
+
+      if (result)
+        return result;
+
+      debug_at(result.error());
+    }
+
+    if (GetEnv("DISPLAY")) {
+      Result<T> result = connections.x11.get().and_then(fromX11);
+
+      if (result)
+        return result;
+
+      debug_at(result.error());
+    }
+
+    ERR(NotFound, "No display server detected");
+  }
+
+  fn OutputsFrom(DisplayConnections& connections) -> Result<Vec<DisplayInfo>> {
+    return FromDisplayServer<Vec<DisplayInfo>>(connections, GetWaylandDisplays, GetX11Displays);
+  }
+
+  fn PrimaryOutputFrom(DisplayConnections& connections) -> Result<DisplayInfo> {
+    return FromDisplayServer<DisplayInfo>(connections, GetWaylandPrimaryDisplay, GetX11PrimaryDisplay);
+  }
+} // namespace
+
+namespace draconis::core::system {
+  using draconis::utils::cache::CacheManager;
+  using draconis::utils::cache::CachePolicy;
+  using draconis::utils::cache::CacheValidator;
+  using draconis::utils::env::GetEnv;
+
+  namespace {
+    using detail::SharedSource;
+
+    /*
+     * The cached readouts below take their source as a function so that
+     * CollectReadouts() can hand every readout built on the same source one
+     * shared read. The fetchers capture it by value: the cache may re-run them
+     * on a background thread after the collection is over.
+     */
+
+  #if DRAC_USE_LINKED_PCI_IDS
+    /**
+     * @brief Looks up a PCI device's vendor and device names.
+     * @details Linked builds carry a table generated from pci.ids at build time, so there's nothing to load.
+     */
+    fn LookupPciNames(CacheManager& /*cache*/, Option<Result<String>>& /*index*/, const u16 vendorId, const u16 deviceId) -> Result<Pair<StringView, StringView>> {
+      return pci::LookupLinked(vendorId, deviceId);
+    }
+  #else
+    /**
+     * @brief The pci.ids index (see PciIds.hpp), built the first time pci.ids is seen.
+     * @details Rebuilt whenever pci.ids is replaced, which the validator notices by its mtime, size and inode.
+     */
+    fn LoadPciIdsIndex(CacheManager& cache) -> Result<String> {
+      const fs::path pciIdsPath = FindPciIDsPath();
+
+      if (pciIdsPath.empty())
+        ERR(NotFound, "Could not find pci.ids");
+
+      return cache.getOrSet<String>("linux_pci_ids_index", CachePolicy::neverExpire(), CacheValidator { .sources = { pciIdsPath } }, [pciIdsPath]() -> Result<String> {
+        return BuildPciIdsIndexFromFile(pciIdsPath);
+      });
+    }
+
+    /**
+     * @brief Looks up a PCI device's vendor and device names.
+     * @details @p index is loaded on first use, so a scan that finds no display controller never touches pci.ids.
+     */
+    fn LookupPciNames(CacheManager& cache, Option<Result<String>>& index, const u16 vendorId, const u16 deviceId) -> Result<Pair<StringView, StringView>> {
+      if (!index)
+        index = LoadPciIdsIndex(cache);
+
+      if (!*index)
+        ERR_FROM(index->error());
+
+      return pci::Lookup(**index, vendorId, deviceId);
+    }
+  #endif
+
+    fn GetDistroIDFrom(CacheManager& cache, Fn<Result<OsRelease>()> read) -> Result<String> {
+      // Only changes across reboots, or when os-release itself is replaced.
+      return cache.getOrSet<String>("linux_distro_id", CachePolicy::untilReboot(cache.getGlobalPolicy()), CacheValidator { .sources = { "/etc/os-release" } }, [read = std::move(read)]() -> Result<String> {
+        return read().and_then(DistroIDFrom);
+      });
+    }
+
+    fn GetOperatingSystemFrom(CacheManager& cache, Fn<Result<OsRelease>()> read) -> Result<OSInfo> {
+      return cache.getOrSet<OSInfo>("linux_os_version", [read = std::move(read)]() -> Result<OSInfo> {
+        return read().and_then(OSInfoFrom);
+      });
+    }
+
+    fn GetWindowManagerFrom(CacheManager& cache, Fn<Result<String>()> read) -> Result<String> {
+      // NOLINTNEXTLINE(misc-redundant-expression) - compile-time values are not always redundant
+      if constexpr (!DRAC_USE_WAYLAND && !DRAC_USE_XCB)
+        ERR(NotSupported, "Wayland or XCB support not available");
+
+      return cache.getOrSet<String>("linux_wm", std::move(read));
+    }
+
+    fn GetNetworkInterfacesFrom(CacheManager& cache, Fn<Result<NetworkSnapshot>()> read) -> Result<Vec<NetworkInterface>> {
+      return cache.getOrSet<Vec<NetworkInterface>>("linux_network_interfaces", [read = std::move(read)]() -> Result<Vec<NetworkInterface>> {
+        return read().transform(InterfaceListFrom);
+      });
+    }
+
+    fn GetPrimaryNetworkInterfaceFrom(CacheManager& cache, Fn<Result<NetworkSnapshot>()> read) -> Result<NetworkInterface> {
+      return cache.getOrSet<NetworkInterface>("linux_primary_network_interface", [read = std::move(read)]() -> Result<NetworkInterface> {
+        return read().and_then(PrimaryInterfaceFrom);
+      });
+    }
+  } // namespace
+
+  namespace linux {
+    fn GetDistroID(CacheManager& cache) -> Result<String> {
+      return GetDistroIDFrom(cache, ReadOsRelease);
+    }
+  } // namespace linux
+
+  fn GetOperatingSystem(CacheManager& cache) -> Result<OSInfo> {
+    return GetOperatingSystemFrom(cache, ReadOsRelease);
+  }
+
+  fn GetMemInfo(CacheManager& /*cache*/) -> Result<ResourceUsage> {
+    return ReadSysinfo().and_then(MemInfoFrom);
+  }
+
   fn GetNowPlaying() -> Result<MediaInfo> {
     if constexpr (!DRAC_ENABLE_NOWPLAYING)
       ERR(NotSupported, "Now Playing API disabled");
@@ -867,18 +1117,9 @@ namespace draconis::core::system {
   }
 
   fn GetWindowManager(CacheManager& cache) -> Result<String> {
-    // NOLINTNEXTLINE(misc-redundant-expression) - compile-time values are not always redundant
-    if constexpr (!DRAC_USE_WAYLAND && !DRAC_USE_XCB)
-      ERR(NotSupported, "Wayland or XCB support not available");
-
-    return cache.getOrSet<String>("linux_wm", [&]() -> Result<String> {
-      if (GetEnv("WAYLAND_DISPLAY"))
-        return GetWaylandCompositor();
-
-      if (GetEnv("DISPLAY"))
-        return GetX11WindowManager();
-
-      ERR(NotFound, "No display server detected");
+    return GetWindowManagerFrom(cache, []() -> Result<String> {
+      DisplayConnections connections;
+      return WindowManagerFrom(connections);
     });
   }
 
@@ -934,38 +1175,23 @@ namespace draconis::core::system {
   }
 
   fn GetHost(CacheManager& cache) -> Result<String> {
-    return cache.getOrSet<String>("linux_host", []() -> Result<String> {
-      constexpr PCStr primaryPath  = "/sys/class/dmi/id/product_family";
-      constexpr PCStr fallbackPath = "/sys/class/dmi/id/product_name";
+    return cache.getOrSet<String>("linux_host", CachePolicy::untilReboot(cache.getGlobalPolicy()), []() -> Result<String> {
+      constexpr PCStr primaryPath  = "product_family";
+      constexpr PCStr fallbackPath = "product_name";
 
-      fn readFirstLine = [&](const String& path) -> Result<String> {
-        std::ifstream file(path);
-        String        line;
+      FileBuffer buffer;
 
-        if (!file.is_open()) {
-          if (errno == EACCES)
-            ERR_FMT(PermissionDenied, "Permission denied when opening DMI product identifier file '{}'", path);
-
-          ERR_FMT(NotFound, "Failed to open DMI product identifier file '{}'", path);
-        }
-
-        if (!std::getline(file, line) || line.empty())
-          ERR_FMT(ParseError, "DMI product identifier file ('{}') is empty", path);
-
-        return line;
-      };
-
-      Result<String> primaryResult = readFirstLine(primaryPath);
+      Result<StringView> primaryResult = DmiDirectory().readLine(primaryPath, buffer);
 
       if (primaryResult)
-        return primaryResult;
+        return String(*primaryResult);
 
       DracError primaryError = primaryResult.error();
 
-      Result<String> fallbackResult = readFirstLine(fallbackPath);
+      Result<StringView> fallbackResult = DmiDirectory().readLine(fallbackPath, buffer);
 
       if (fallbackResult)
-        return fallbackResult;
+        return String(*fallbackResult);
 
       DracError fallbackError = fallbackResult.error();
 
@@ -980,100 +1206,104 @@ namespace draconis::core::system {
     });
   }
 
-  fn GetCPUModel(CacheManager& /*cache*/) -> Result<String> {
-    Array<u32, 4>   cpuInfo;
-    Array<char, 49> brandString = { 0 };
+  fn GetCPUModel(CacheManager& cache) -> Result<String> {
+    return cache.getOrSet<String>("linux_cpu_model", CachePolicy::untilReboot(cache.getGlobalPolicy()), []() -> Result<String> {
+      Array<u32, 4>   cpuInfo;
+      Array<char, 49> brandString = { 0 };
 
-    __get_cpuid(0x80000000, cpuInfo.data(), &cpuInfo[1], &cpuInfo[2], &cpuInfo[3]);
-    const u32 maxFunction = cpuInfo[0];
+      __get_cpuid(0x80000000, cpuInfo.data(), &cpuInfo[1], &cpuInfo[2], &cpuInfo[3]);
+      const u32 maxFunction = cpuInfo[0];
 
-    if (maxFunction < 0x80000004)
-      ERR(NotSupported, "CPU does not support brand string");
+      if (maxFunction < 0x80000004)
+        ERR(NotSupported, "CPU does not support brand string");
 
-    for (u32 i = 0; i < 3; ++i) {
-      __get_cpuid(0x80000002 + i, cpuInfo.data(), &cpuInfo[1], &cpuInfo[2], &cpuInfo[3]);
-      std::memcpy(&brandString.at(i * 16), cpuInfo.data(), sizeof(cpuInfo));
-    }
+      for (u32 i = 0; i < 3; ++i) {
+        __get_cpuid(0x80000002 + i, cpuInfo.data(), &cpuInfo[1], &cpuInfo[2], &cpuInfo[3]);
+        std::memcpy(&brandString.at(i * 16), cpuInfo.data(), sizeof(cpuInfo));
+      }
 
-    String result(brandString.data());
+      String result(brandString.data());
 
-    result.erase(result.find_last_not_of(" \t\n\r") + 1);
+      result.erase(result.find_last_not_of(" \t\n\r") + 1);
 
-    if (result.empty())
-      ERR(InternalError, "Failed to get CPU model string via CPUID");
+      if (result.empty())
+        ERR(InternalError, "Failed to get CPU model string via CPUID");
 
-    return result;
+      return result;
+    });
   }
 
-  fn GetCPUCores(CacheManager& /*cache*/) -> Result<CPUCores> {
-    u32 eax = 0, ebx = 0, ecx = 0, edx = 0;
+  fn GetCPUCores(CacheManager& cache) -> Result<CPUCores> {
+    return cache.getOrSet<CPUCores>("linux_cpu_cores", CachePolicy::untilReboot(cache.getGlobalPolicy()), []() -> Result<CPUCores> {
+      u32 eax = 0, ebx = 0, ecx = 0, edx = 0;
 
-    __get_cpuid(0x0, &eax, &ebx, &ecx, &edx);
-    const u32 maxLeaf   = eax;
-    const u32 vendorEbx = ebx;
+      __get_cpuid(0x0, &eax, &ebx, &ecx, &edx);
+      const u32 maxLeaf   = eax;
+      const u32 vendorEbx = ebx;
 
-    u32 logicalCores  = 0;
-    u32 physicalCores = 0;
+      u32 logicalCores  = 0;
+      u32 physicalCores = 0;
 
-    if (maxLeaf >= 0xB) {
-      u32 threadsPerCore = 0;
-      for (u32 subleaf = 0;; ++subleaf) {
-        __get_cpuid_count(0xB, subleaf, &eax, &ebx, &ecx, &edx);
-        if (ebx == 0)
-          break;
+      if (maxLeaf >= 0xB) {
+        u32 threadsPerCore = 0;
+        for (u32 subleaf = 0;; ++subleaf) {
+          __get_cpuid_count(0xB, subleaf, &eax, &ebx, &ecx, &edx);
+          if (ebx == 0)
+            break;
 
-        const u32 levelType         = (ecx >> 8) & 0xFF;
-        const u32 processorsAtLevel = ebx & 0xFFFF;
+          const u32 levelType         = (ecx >> 8) & 0xFF;
+          const u32 processorsAtLevel = ebx & 0xFFFF;
 
-        if (levelType == 1) // SMT (Hyper-Threading) level
-          threadsPerCore = processorsAtLevel;
+          if (levelType == 1) // SMT (Hyper-Threading) level
+            threadsPerCore = processorsAtLevel;
 
-        if (levelType == 2) // Core level
-          logicalCores = processorsAtLevel;
-      }
+          if (levelType == 2) // Core level
+            logicalCores = processorsAtLevel;
+        }
 
-      if (logicalCores > 0 && threadsPerCore > 0)
-        physicalCores = logicalCores / threadsPerCore;
-    }
+        if (logicalCores > 0 && threadsPerCore > 0)
+          physicalCores = logicalCores / threadsPerCore;
+      }
 
-    if (physicalCores == 0 || logicalCores == 0) {
-      __get_cpuid(0x1, &eax, &ebx, &ecx, &edx);
-      logicalCores                 = (ebx >> 16) & 0xFF;
-      const bool hasHyperthreading = (edx & (1 << 28)) != 0;
-
-      if (hasHyperthreading) {
-        constexpr u32 vendorIntel = 0x756e6547; // "Genu"ine"Intel"
-        constexpr u32 vendorAmd   = 0x68747541; // "Auth"entic"AMD"
-
-        if (vendorEbx == vendorIntel && maxLeaf >= 0x4) {
-          __get_cpuid_count(0x4, 0, &eax, &ebx, &ecx, &edx);
-          physicalCores = ((eax >> 26) & 0x3F) + 1;
-        } else if (vendorEbx == vendorAmd) {
-          __get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx); // Get max extended leaf
-          if (eax >= 0x80000008) {
-            __get_cpuid(0x80000008, &eax, &ebx, &ecx, &edx);
-            physicalCores = (ecx & 0xFF) + 1;
+      if (physicalCores == 0 || logicalCores == 0) {
+        __get_cpuid(0x1, &eax, &ebx, &ecx, &edx);
+        logicalCores                 = (ebx >> 16) & 0xFF;
+        const bool hasHyperthreading = (edx & (1 << 28)) != 0;
+
+        if (hasHyperthreading) {
+          constexpr u32 vendorIntel = 0x756e6547; // "Genu"ine"Intel"
+          constexpr u32 vendorAmd   = 0x68747541; // "Auth"entic"AMD"
+
+          if (vendorEbx == vendorIntel && maxLeaf >= 0x4) {
+            __get_cpuid_count(0x4, 0, &eax, &ebx, &ecx, &edx);
+            physicalCores = ((eax >> 26) & 0x3F) + 1;
+          } else if (vendorEbx == vendorAmd) {
+            __get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx); // Get max extended leaf
+            if (eax >= 0x80000008) {
+              __get_cpuid(0x80000008, &eax, &ebx, &ecx, &edx);
+              physicalCores = (ecx & 0xFF) + 1;
+            }
           }
+        } else {
+          physicalCores = logicalCores;
         }
-      } else {
-        physicalCores = logicalCores;
       }
-    }
 
-    if (physicalCores == 0 && logicalCores > 0)
-      physicalCores = logicalCores;
+      if (physicalCores == 0 && logicalCores > 0)
+        physicalCores = logicalCores;
 
-    if (physicalCores == 0 || logicalCores == 0)
-      ERR(InternalError, "Failed to determine core counts via CPUID");
+      if (physicalCores == 0 || logicalCores == 0)
+        ERR(InternalError, "Failed to determine core counts via CPUID");
 
-    return CPUCores(physicalCores, logicalCores);
+      return CPUCores(physicalCores, logicalCores);
+    });
   }
 
   fn GetGPUModel(CacheManager& cache) -> Result<String> {
-    return cache.getOrSet<String>("linux_gpu_model", []() -> Result<String> {
-      const fs::path pciPath = "/sys/bus/pci/devices";
+    return cache.getOrSet<String>("linux_gpu_model", CachePolicy::untilReboot(cache.getGlobalPolicy()), [&cache]() -> Result<String> {
+      const Directory& pciDevices = PciDevicesDirectory();
 
-      if (!fs::exists(pciPath))
+      if (!pciDevices)
         ERR(NotFound, "PCI device path '/sys/bus/pci/devices' not found.");
 
       // clang-format off
@@ -1084,42 +1314,65 @@ namespace draconis::core::system {
       }};
       // clang-format on
 
-      for (const fs::directory_entry& entry : fs::directory_iterator(pciPath)) {
-        if (Result<String> classIdRes = ReadSysFile(entry.path() / "class"); !classIdRes || !classIdRes->starts_with("0x03"))
-          continue;
+      Option<Result<String>> model;
+      Option<Result<String>> pciIdsIndex; // Filled in by LookupPciNames() on first use.
+
+      // Attributes here are one short line each, so small stack buffers are plenty.
+      Result<bool> found = pciDevices.forEachEntry([&](const StringView name) -> bool {
+        Result<Directory> device = pciDevices.open(name.data());
+
+        if (!device)
+          return false;
 
-        Result<String> vendorIdRes = ReadSysFile(entry.path() / "vendor");
-        Result<String> deviceIdRes = ReadSysFile(entry.path() / "device");
+        Array<char, 32> classBuffer, vendorBuffer, deviceBuffer;
 
-        if (vendorIdRes && deviceIdRes)
-          if (Result<Pair<String, String>> pciNames = LookupPciNames(*vendorIdRes, *deviceIdRes))
-            return CleanGpuModelName(std::move(pciNames->first), std::move(pciNames->second));
+        if (Result<StringView> classIdRes = device->readLine("class", classBuffer); !classIdRes || !classIdRes->starts_with("0x03"))
+          return false;
+
+        Result<StringView> vendorIdRes = device->readLine("vendor", vendorBuffer);
+        Result<StringView> deviceIdRes = device->readLine("device", deviceBuffer);
+
+        if (vendorIdRes && deviceIdRes) {
+          const Result<u16> vendorId = pci::ParseId(*vendorIdRes);
+          const Result<u16> deviceId = pci::ParseId(*deviceIdRes);
+
+          if (vendorId && deviceId)
+            if (Result<Pair<StringView, StringView>> pciNames = LookupPciNames(cache, pciIdsIndex, *vendorId, *deviceId)) {
+              model = CleanGpuModelName(String(pciNames->first), String(pciNames->second));
+              return true;
+            }
+        }
 
         if (vendorIdRes) {
           const auto* iter = std::ranges::find_if(fallbackVendorMap, [&](const auto& pair) {
             return pair.first == *vendorIdRes;
           });
 
-          if (iter != fallbackVendorMap.end())
-            return String(iter->second);
+          if (iter != fallbackVendorMap.end()) {
+            model = String(iter->second);
+            return true;
+          }
         }
-      }
+
+        return false;
+      });
+
+      if (!found)
+        ERR_FROM(found.error());
+
+      if (model)
+        return *std::move(model);
 
       ERR(NotFound, "No compatible GPU found in /sys/bus/pci/devices.");
     });
   }
 
   fn GetUptime() -> Result<std::chrono::seconds> {
-    struct sysinfo info;
-
-    if (sysinfo(&info) != 0)
-      ERR(InternalError, "sysinfo call failed");
-
-    return std::chrono::seconds(info.uptime);
+    return UptimeFrom(ReadSysinfo());
   }
 
   fn GetKernelVersion(CacheManager& cache) -> Result<String> {
-    return cache.getOrSet<String>("linux_kernel_version", []() -> Result<String> {
+    return cache.getOrSet<String>("linux_kernel_version", CachePolicy::untilReboot(cache.getGlobalPolicy()), []() -> Result<String> {
       utsname uts;
 
       if (uname(&uts) == -1)
@@ -1142,152 +1395,64 @@ namespace draconis::core::system {
   }
 
   fn GetOutputs(CacheManager& /*cache*/) -> Result<Vec<DisplayInfo>> {
-    if (GetEnv("WAYLAND_DISPLAY")) {
-      Result<Vec<DisplayInfo>> displays = GetWaylandDisplays();
-
-      if (displays)
-        return displays;
-
-      debug_at(displays.error());
-    }
-
-    if (GetEnv("DISPLAY")) {
-      Result<Vec<DisplayInfo>> displays = GetX11Displays();
-
-      if (displays)
-        return displays;
-
-      debug_at(displays.error());
-    }
-
-    ERR(NotFound, "No display server detected");
+    DisplayConnections connections;
+    return OutputsFrom(connections);
   }
 
   fn GetPrimaryOutput(CacheManager& /*cache*/) -> Result<DisplayInfo> {
-    if (GetEnv("WAYLAND_DISPLAY")) {
-      Result<DisplayInfo> display = GetWaylandPrimaryDisplay();
-
-      if (display)
-        return display;
-
-      debug_at(display.error());
-    }
-
-    if (GetEnv("DISPLAY")) {
-      Result<DisplayInfo> display = GetX11PrimaryDisplay();
-
-      if (display)
-        return display;
-
-      debug_at(display.error());
-    }
-
-    ERR(NotFound, "No display server detected");
+    DisplayConnections connections;
+    return PrimaryOutputFrom(connections);
   }
 
   fn GetNetworkInterfaces(CacheManager& cache) -> Result<Vec<NetworkInterface>> {
-    return cache.getOrSet<Vec<NetworkInterface>>("linux_network_interfaces", []() -> Result<Vec<NetworkInterface>> {
-      Result<Map<String, NetworkInterface>> mapResult = CollectNetworkInterfaces();
-      if (!mapResult)
-        ERR_FROM(mapResult.error());
-
-      const Map<String, NetworkInterface>& interfaceMap = *mapResult;
-
-      Vec<NetworkInterface> interfaces;
-      interfaces.reserve(interfaceMap.size());
-
-      std::ranges::copy(interfaceMap | std::views::values, std::back_inserter(interfaces));
-
-      return interfaces;
-    });
+    return GetNetworkInterfacesFrom(cache, CollectNetworkSnapshot);
   }
 
   fn GetPrimaryNetworkInterface(CacheManager& cache) -> Result<NetworkInterface> {
-    return cache.getOrSet<NetworkInterface>("linux_primary_network_interface", []() -> Result<NetworkInterface> {
-      // Gather full interface list first
-      Result<Map<String, NetworkInterface>> mapResult = CollectNetworkInterfaces();
-
-      if (!mapResult)
-        ERR_FROM(mapResult.error());
-
-      const Map<String, NetworkInterface>& interfaces = *mapResult;
-
-      // Attempt to determine primary interface via default route
-      String        primaryInterfaceName;
-      std::ifstream routeFile("/proc/net/route");
-
-      if (routeFile.is_open()) {
-        String line;
-        std::getline(routeFile, line); // skip header
-
-        while (std::getline(routeFile, line)) {
-          std::istringstream iss(line);
-          String             iface, dest, gateway, flags, refcnt, use, metric, mask, mtu, window, irtt;
-
-          if (iss >> iface >> dest >> gateway >> flags >> refcnt >> use >> metric >> mask >> mtu >> window >> irtt && dest == "00000000") {
-            primaryInterfaceName = iface;
-            break;
-          }
-        }
-      }
-
-      // Fallback: first non-loopback interface that is up (Ranges style)
-      if (primaryInterfaceName.empty())
-        if (auto iter = std::ranges::find_if(
-              interfaces,
-              [](const auto& pair) {
-                const auto& iface = pair.second;
-                return iface.isUp && !iface.isLoopback;
-              }
-            );
-            iter != interfaces.end()) {
-          primaryInterfaceName = iter->first;
-        }
-
-      if (primaryInterfaceName.empty())
-        ERR(NotFound, "Could not determine primary interface name");
-
-      const auto iter = interfaces.find(primaryInterfaceName);
-      if (iter == interfaces.end())
-        ERR(NotFound, "Found primary interface name, but could not find its details");
-
-      return iter->second;
-    });
+    return GetPrimaryNetworkInterfaceFrom(cache, CollectNetworkSnapshot);
   }
 
   fn GetBatteryInfo(CacheManager& /*cache*/) -> Result<Battery> {
     using matchit::match, matchit::is, matchit::_;
     using enum Battery::Status;
 
-    PCStr powerSupplyPath = "/sys/class/power_supply";
+    const Directory& powerSupply = PowerSupplyDirectory();
 
-    if (!fs::exists(powerSupplyPath))
+    if (!powerSupply)
       ERR(NotFound, "Power supply directory not found");
 
     // Find the first battery device
-    fs::path batteryPath;
-    for (const fs::directory_entry& entry : fs::directory_iterator(powerSupplyPath))
-      if (Result<String> typeResult = ReadSysFile(entry.path() / "type");
-          typeResult && *typeResult == "Battery") {
-        batteryPath = entry.path();
-        break;
-      }
+    Option<Directory> batteryDir;
+
+    (void)powerSupply.forEachEntry([&](const StringView name) -> bool {
+      Result<Directory> supply = powerSupply.open(name.data());
+
+      if (!supply)
+        return false;
+
+      Array<char, 32> typeBuffer;
+
+      if (Result<StringView> type = supply->readLine("type", typeBuffer); !type || *type != "Battery")
+        return false;
+
+      batteryDir = *std::move(supply);
+      return true;
+    });
 
-    if (batteryPath.empty())
+    if (!batteryDir)
       ERR(NotFound, "No battery found in power supply directory");
 
     // Read battery percentage
-    Option<u8> percentage =
-      ReadSysFile(batteryPath / "capacity")
-        .transform([](const String& capacityStr) -> Option<u8> {
-          return TryParse<u8>(capacityStr);
-        })
-        .value_or(None);
+    Option<u8> percentage = batteryDir->readInt<u8>("capacity")
+                              .transform([](const u8 capacity) -> Option<u8> { return capacity; })
+                              .value_or(None);
 
     // Read battery status
+    Array<char, 32> statusBuffer;
+
     Battery::Status status =
-      ReadSysFile(batteryPath / "status")
-        .transform([percentage](const String& statusStr) -> Battery::Status {
+      batteryDir->readLine("status", statusBuffer)
+        .transform([percentage](const StringView statusStr) -> Battery::Status {
           return match(statusStr)(
             is | "Charging"     = Charging,
             is | "Discharging"  = Discharging,
@@ -1304,29 +1469,78 @@ namespace draconis::core::system {
     return Battery(
       status,
       percentage,
-      ReadSysFile(
-        batteryPath / std::format("/time_to_{}now", status == Discharging ? "empty" : "full")
-      )
-        .transform([](const String& timeStr) -> Option<std::chrono::seconds> {
-          if (Option<i32> timeMinutes = TryParse<i32>(timeStr); timeMinutes && *timeMinutes > 0)
-            return std::chrono::minutes(*timeMinutes);
+      batteryDir->readInt<i32>(status == Discharging ? "time_to_empty_now" : "time_to_full_now")
+        // The power_supply ABI reports these in seconds.
+        .transform([](const i32 timeSeconds) -> Option<std::chrono::seconds> {
+          if (timeSeconds > 0)
+            return std::chrono::seconds(timeSeconds);
 
           return None;
         })
         .value_or(None)
     );
   }
+
+  fn detail::CollectSharedSources(CacheManager& cache, const Readout readouts, Readouts& out) -> Unit {
+    using enum Readout;
+
+    // Cache hits never touch their source, so none of these are read unless a readout actually needs them.
+    const auto sysInfo     = std::make_shared<SharedSource<SysInfo>>(ReadSysinfo);
+    const auto osRelease   = std::make_shared<SharedSource<OsRelease>>(ReadOsRelease);
+    const auto network     = std::make_shared<SharedSource<NetworkSnapshot>>(CollectNetworkSnapshot);
+    const auto connections = std::make_shared<DisplayConnections>();
+
+    if (HasReadout(readouts, MemInfo))
+      out.memInfo = sysInfo->get().and_then(MemInfoFrom);
+
+    if (HasReadout(readouts, Uptime))
+      out.uptime = UptimeFrom(sysInfo->get());
+
+    if (HasReadout(readouts, OperatingSystem))
+      out.operatingSystem = GetOperatingSystemFrom(cache, [osRelease] { return osRelease->get(); });
+
+    if (HasReadout(readouts, DistroID))
+      out.distroId = GetDistroIDFrom(cache, [osRelease] { return osRelease->get(); });
+
+    if (HasReadout(readouts, WindowManager))
+      out.windowManager = GetWindowManagerFrom(cache, [connections] { return WindowManagerFrom(*connections); });
+
+    if (HasReadout(readouts, Outputs))
+      out.outputs = OutputsFrom(*connections);
+
+    if (HasReadout(readouts, PrimaryOutput))
+      out.primaryOutput = PrimaryOutputFrom(*connections);
+
+    if (HasReadout(readouts, NetworkInterfaces))
+      out.networkInterfaces = GetNetworkInterfacesFrom(cache, [network] { return network->get(); });
+
+    if (HasReadout(readouts, PrimaryNetworkInterface))
+      out.primaryNetworkInterface = GetPrimaryNetworkInterfaceFrom(cache, [network] { return network->get(); });
+
+    // Drops the connections and parsed data now; later background refreshes read their sources afresh.
+    sysInfo->close();
+    osRelease->close();
+    network->close();
+    connections->close();
+  }
 } // namespace draconis::core::system
 
   #ifdef DRAC_ENABLE_PACKAGECOUNT
 namespace draconis::services::packages {
-  using draconis::utils::cache::CacheManager;
+  using draconis::utils::cache::CacheManager, draconis::utils::cache::CachePolicy, draconis::utils::cache::CacheValidator;
 
   fn CountApk(CacheManager& cache) -> Result<u64> {
     const String   pmID      = "apk";
     const fs::path apkDbPath = "/lib/apk/db/installed";
 
-    return cache.getOrSet<u64>(std::format("pkg_count_{}", pmID), [&]() -> Result<u64> {
+    const CacheValidator validator { .sources = { apkDbPath } };
+
+    // A missing database is remembered as well; the validator notices if it appears.
+    CachePolicy policy = cache.getGlobalPolicy();
+    policy.ttl         = None;
+    policy.negativeTtl = std::chrono::days(1);
+
+    return cache.getOrSet<u64>(std::format("pkg_count_{}", pmID), policy, validator, [apkDbPath]() -> Result<u64> {
       if (std::error_code fsErrCode; !fs::exists(apkDbPath, fsErrCode)) {
         if (fsErrCode) {
           warn_log("Filesystem error checking for Apk DB at '{}': {}", apkDbPath.string(), fsErrCode.message());
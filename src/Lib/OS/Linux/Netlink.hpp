@@ -0,0 +1,393 @@
+/**
+ * @file Netlink.hpp
+ * @brief Minimal rtnetlink client for link, address and route dumps.
+ *
+ * A dump is one request on a NETLINK_ROUTE socket, answered by batches of
+ * messages that are received into a caller-provided buffer and walked in
+ * place. Messages and their attributes are handed out as views into that
+ * buffer, so nothing is copied or allocated per interface, address or route.
+ *
+ * @code{.cpp}
+ * Result<Socket> socket = Socket::open();
+ * ReceiveBuffer  buffer;
+ *
+ * Result<> done = socket->dump(RTM_GETLINK, AF_UNSPEC, buffer, [](const Message& message) {
+ *   if (const Option<Link> link = ParseLink(message))
+ *     debug_log("{} has MTU {}", link->name, link->mtu.value_or(0));
+ * });
+ * @endcode
+ */
+
+#pragma once
+
+#ifdef __linux__
+
+  #include <algorithm>         // std::min
+  #include <cerrno>            // errno, EACCES, EINTR, EPERM
+  #include <cstddef>           // offsetof
+  #include <cstring>           // std::{memcpy, strerror}
+  #include <format>            // std::format
+  #include <linux/if_link.h>   // IFLA_*, rtnl_link_stats64
+  #include <linux/netlink.h>   // nlmsghdr, nlmsgerr, sockaddr_nl, NLM_F_*, NLMSG_*
+  #include <linux/rtnetlink.h> // RTM_*, RTA_*, IFA_*, ifinfomsg, ifaddrmsg, rtmsg, rtattr, rtnexthop
+  #include <sys/socket.h>      // socket, sendto, recv, AF_NETLINK
+  #include <utility>           // std::{forward, move}
+
+  #include <Drac++/Utils/Error.hpp>
+  #include <Drac++/Utils/Types.hpp>
+
+  #include "OS/Linux/SysFs.hpp"
+
+namespace draconis::core::system::linux::netlink {
+  namespace {
+    using draconis::utils::error::DracError;
+    using enum draconis::utils::error::DracErrorCode;
+
+    using draconis::utils::types::Array;
+    using draconis::utils::types::Err;
+    using draconis::utils::types::i32;
+    using draconis::utils::types::isize;
+    using draconis::utils::types::None;
+    using draconis::utils::types::Option;
+    using draconis::utils::types::Result;
+    using draconis::utils::types::Span;
+    using draconis::utils::types::StringView;
+    using draconis::utils::types::u16;
+    using draconis::utils::types::u32;
+    using draconis::utils::types::u64;
+    using draconis::utils::types::u8;
+    using draconis::utils::types::usize;
+
+    using sysfs::FileDescriptor;
+  } // namespace
+
+  /// The kernel never fills a dump batch past 32 KiB, so one batch always fits.
+  inline constexpr usize RECEIVE_BUFFER_SIZE = 32768;
+
+  using ReceiveBuffer = Array<char, RECEIVE_BUFFER_SIZE>;
+
+  using Bytes = Span<const char>;
+
+  /**
+   * @brief Copies a T out of the start of @p bytes, or returns None if there aren't enough of them.
+   * @details Netlink only aligns to 4 bytes, so fields are copied out rather than read in place.
+   */
+  template <typename T>
+  fn ReadAs(const Bytes bytes, const usize offset = 0) -> Option<T> {
+    if (offset > bytes.size() || bytes.size() - offset < sizeof(T))
+      return None;
+
+    T value;
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+
+    return value;
+  }
+
+  /**
+   * @brief One attribute of a message: a type and a view of its payload.
+   */
+  struct Attribute {
+    u16   type;
+    Bytes data;
+
+    template <typename T>
+    [[nodiscard]] fn as() const -> Option<T> {
+      return ReadAs<T>(data);
+    }
+
+    /**
+     * @brief The payload as a string, up to its terminating NUL.
+     */
+    [[nodiscard]] fn string() const -> StringView {
+      const StringView text(data.data(), data.size());
+      return text.substr(0, text.find('\0'));
+    }
+  };
+
+  /**
+   * @brief One reply message, with the netlink header already stripped.
+   */
+  struct Message {
+    u16   type;
+    Bytes payload; ///< The family header (ifinfomsg, ifaddrmsg, ...) followed by attributes.
+  };
+
+  /**
+   * @brief Calls @p visit with each attribute in @p bytes.
+   */
+  template <typename F>
+  fn ForEachAttribute(Bytes bytes, F&& visit) -> void {
+    while (const Option<rtattr> header = ReadAs<rtattr>(bytes)) {
+      if (header->rta_len < sizeof(rtattr) || header->rta_len > bytes.size())
+        return;
+
+      visit(Attribute {
+        .type = static_cast<u16>(header->rta_type & NLA_TYPE_MASK),
+        .data = bytes.subspan(RTA_LENGTH(0), header->rta_len - RTA_LENGTH(0)),
+      });
+
+      bytes = bytes.subspan(std::min<usize>(RTA_ALIGN(header->rta_len), bytes.size()));
+    }
+  }
+
+  /**
+   * @brief Calls @p visit with each attribute of @p message that follows its family header T.
+   */
+  template <typename T, typename F>
+  fn ForEachAttribute(const Message& message, F&& visit) -> void {
+    if (message.payload.size() >= NLMSG_ALIGN(sizeof(T)))
+      ForEachAttribute(message.payload.subspan(NLMSG_ALIGN(sizeof(T))), std::forward<F>(visit));
+  }
+
+  /**
+   * @brief An RTM_NEWLINK message.
+   */
+  struct Link {
+    i32         index;
+    u32         flags; ///< IFF_* flags.
+    StringView  name;
+    Option<u32> mtu;
+    Bytes       hardwareAddress; ///< Empty if the link has none.
+    Option<u64> rxBytes;
+    Option<u64> txBytes;
+    Option<u64> rxPackets;
+    Option<u64> txPackets;
+  };
+
+  inline fn ParseLink(const Message& message) -> Option<Link> {
+    const Option<ifinfomsg> info = ReadAs<ifinfomsg>(message.payload);
+
+    if (message.type != RTM_NEWLINK || !info)
+      return None;
+
+    Link link {
+      .index           = info->ifi_index,
+      .flags           = info->ifi_flags,
+      .name            = {},
+      .mtu             = None,
+      .hardwareAddress = {},
+      .rxBytes         = None,
+      .txBytes         = None,
+      .rxPackets       = None,
+      .txPackets       = None,
+    };
+
+    ForEachAttribute<ifinfomsg>(message, [&link](const Attribute& attribute) {
+      switch (attribute.type) {
+        case IFLA_IFNAME:  link.name = attribute.string(); break;
+        case IFLA_MTU:     link.mtu = attribute.as<u32>(); break;
+        case IFLA_ADDRESS: link.hardwareAddress = attribute.data; break;
+        case IFLA_STATS64:
+          // Read field by field: the struct has grown over time, and older kernels send a shorter one.
+          link.rxBytes   = ReadAs<u64>(attribute.data, offsetof(rtnl_link_stats64, rx_bytes));
+          link.txBytes   = ReadAs<u64>(attribute.data, offsetof(rtnl_link_stats64, tx_bytes));
+          link.rxPackets = ReadAs<u64>(attribute.data, offsetof(rtnl_link_stats64, rx_packets));
+          link.txPackets = ReadAs<u64>(attribute.data, offsetof(rtnl_link_stats64, tx_packets));
+          break;
+        default: break;
+      }
+    });
+
+    if (link.name.empty())
+      return None;
+
+    return link;
+  }
+
+  /**
+   * @brief An RTM_NEWADDR message.
+   */
+  struct Address {
+    i32   index; ///< Of the link the address is on.
+    u8    family;
+    u8    scope; ///< RT_SCOPE_*; link-local addresses are RT_SCOPE_LINK.
+    Bytes address;
+  };
+
+  inline fn ParseAddress(const Message& message) -> Option<Address> {
+    const Option<ifaddrmsg> info = ReadAs<ifaddrmsg>(message.payload);
+
+    if (message.type != RTM_NEWADDR || !info)
+      return None;
+
+    Bytes address, local;
+
+    ForEachAttribute<ifaddrmsg>(message, [&](const Attribute& attribute) {
+      if (attribute.type == IFA_ADDRESS)
+        address = attribute.data;
+      else if (attribute.type == IFA_LOCAL)
+        local = attribute.data;
+    });
+
+    // On point-to-point links IFA_ADDRESS is the peer's address; IFA_LOCAL is always ours when present.
+    const Bytes own = local.empty() ? address : local;
+
+    if (own.empty())
+      return None;
+
+    return Address {
+      .index   = static_cast<i32>(info->ifa_index),
+      .family  = info->ifa_family,
+      .scope   = info->ifa_scope,
+      .address = own,
+    };
+  }
+
+  /**
+   * @brief A default route of the main routing table.
+   */
+  struct Route {
+    u8  family;
+    i32 outputIndex; ///< Of the link the route sends through.
+    u32 priority;    ///< The route metric; lower wins.
+  };
+
+  /**
+   * @brief Parses an RTM_NEWROUTE message, if it's a default route.
+   * @details Multipath routes are reported through their first hop.
+   */
+  inline fn ParseDefaultRoute(const Message& message) -> Option<Route> {
+    const Option<rtmsg> info = ReadAs<rtmsg>(message.payload);
+
+    if (message.type != RTM_NEWROUTE || !info || info->rtm_dst_len != 0 || info->rtm_type != RTN_UNICAST)
+      return None;
+
+    u32         table = info->rtm_table;
+    Option<i32> outputIndex;
+    u32         priority = 0;
+
+    ForEachAttribute<rtmsg>(message, [&](const Attribute& attribute) {
+      switch (attribute.type) {
+        case RTA_TABLE:    table = attribute.as<u32>().value_or(table); break;
+        case RTA_OIF:      outputIndex = attribute.as<i32>(); break;
+        case RTA_PRIORITY: priority = attribute.as<u32>().value_or(0); break;
+        case RTA_MULTIPATH:
+          if (!outputIndex)
+            if (const Option<rtnexthop> hop = attribute.as<rtnexthop>())
+              outputIndex = hop->rtnh_ifindex;
+          break;
+        default: break;
+      }
+    });
+
+    if (table != RT_TABLE_MAIN || !outputIndex)
+      return None;
+
+    return Route { .family = info->rtm_family, .outputIndex = *outputIndex, .priority = priority };
+  }
+
+  /**
+   * @brief A NETLINK_ROUTE socket.
+   */
+  class Socket {
+   public:
+    static fn open() -> Result<Socket> {
+      FileDescriptor descriptor(::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE));
+
+      if (!descriptor) {
+        if (errno == EACCES || errno == EPERM)
+          ERR(PermissionDenied, "Not allowed to open a netlink socket");
+
+        ERR_FMT(ApiUnavailable, "Failed to open a netlink socket: {}", std::strerror(errno));
+      }
+
+      return Socket(std::move(descriptor));
+    }
+
+    /**
+     * @brief Requests a dump of @p type (RTM_GETLINK, RTM_GETADDR, RTM_GETROUTE) and calls @p visit with each reply.
+     * @param family AF_UNSPEC for every family, or AF_INET/AF_INET6 for just one.
+     * @param buffer Holds one batch of replies at a time; the messages passed to @p visit point into it.
+     */
+    template <typename F>
+    fn dump(const u16 type, const u8 family, ReceiveBuffer& buffer, F&& visit) -> Result<> {
+      const u32 sequence = ++m_sequence;
+
+      if (Result<> sent = request(type, family, sequence); !sent)
+        return sent;
+
+      while (true) {
+        isize received = 0;
+
+        do
+          received = ::recv(m_fd.get(), buffer.data(), buffer.size(), MSG_TRUNC);
+        while (received < 0 && errno == EINTR);
+
+        if (received < 0)
+          ERR_FMT(IoError, "Failed to receive a netlink reply: {}", std::strerror(errno));
+
+        if (static_cast<usize>(received) > buffer.size())
+          ERR(IoError, "Netlink reply was larger than the receive buffer");
+
+        Bytes batch(buffer.data(), static_cast<usize>(received));
+
+        while (const Option<nlmsghdr> header = ReadAs<nlmsghdr>(batch)) {
+          if (header->nlmsg_len < NLMSG_HDRLEN || header->nlmsg_len > batch.size())
+            ERR(CorruptedData, "Malformed netlink message");
+
+          const Bytes payload = batch.subspan(NLMSG_HDRLEN, header->nlmsg_len - NLMSG_HDRLEN);
+
+          batch = batch.subspan(std::min<usize>(NLMSG_ALIGN(header->nlmsg_len), batch.size()));
+
+          if (header->nlmsg_seq != sequence)
+            continue;
+
+          if (header->nlmsg_type == NLMSG_DONE)
+            return {};
+
+          if (header->nlmsg_type == NLMSG_ERROR) {
+            const i32 error = ReadAs<nlmsgerr>(payload).transform([](const nlmsgerr& err) { return -err.error; }).value_or(EIO);
+
+            if (error == 0)
+              return {};
+
+            ERR_FMT(error == EACCES || error == EPERM ? PermissionDenied : ApiUnavailable, "Netlink request {} failed: {}", type, std::strerror(error));
+          }
+
+          visit(Message { .type = header->nlmsg_type, .payload = payload });
+        }
+      }
+    }
+
+   private:
+    explicit Socket(FileDescriptor descriptor) : m_fd(std::move(descriptor)) {}
+
+    fn request(const u16 type, const u8 family, const u32 sequence) const -> Result<> {
+      // rtgenmsg is all a dump request needs; the kernel reads the family from its first byte.
+      struct Request {
+        nlmsghdr header;
+        rtgenmsg body;
+      };
+
+      const Request request {
+        .header = {
+          .nlmsg_len   = NLMSG_LENGTH(sizeof(rtgenmsg)),
+          .nlmsg_type  = type,
+          .nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP,
+          .nlmsg_seq   = sequence,
+          .nlmsg_pid   = 0,
+        },
+        .body = { .rtgen_family = family },
+      };
+
+      const sockaddr_nl kernel { .nl_family = AF_NETLINK, .nl_pad = 0, .nl_pid = 0, .nl_groups = 0 };
+
+      isize sent = 0;
+
+      do
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) - sockaddr_nl is a sockaddr
+        sent = ::sendto(m_fd.get(), &request, request.header.nlmsg_len, 0, reinterpret_cast<const sockaddr*>(&kernel), sizeof(kernel));
+      while (sent < 0 && errno == EINTR);
+
+      if (sent < 0)
+        ERR_FMT(IoError, "Failed to send netlink request {}: {}", type, std::strerror(errno));
+
+      return {};
+    }
+
+    FileDescriptor m_fd;
+    u32            m_sequence = 0;
+  };
+} // namespace draconis::core::system::linux::netlink
+
+#endif // __linux__
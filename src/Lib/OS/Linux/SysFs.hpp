@@ -0,0 +1,367 @@
+/**
+ * @file SysFs.hpp
+ * @brief Allocation-free reads of small sysfs, procfs and /etc files.
+ *
+ * Files are opened with openat() relative to a directory descriptor that is
+ * opened once and kept, and read with a single pread() into a caller-provided
+ * stack buffer. Results are views into that buffer, so nothing is allocated
+ * unless an error message has to be formatted.
+ *
+ * @code{.cpp}
+ * static const Directory dmi("/sys/class/dmi/id");
+ *
+ * FileBuffer         buffer;
+ * Result<StringView> family = dmi.readLine("product_family", buffer);
+ * @endcode
+ */
+
+#pragma once
+
+#ifdef __linux__
+
+  #include <cerrno>        // errno, EACCES, EINTR, ENOENT, ENOTDIR
+  #include <charconv>      // std::from_chars
+  #include <cstring>       // std::{memmove, strerror}
+  #include <fcntl.h>       // open, openat, O_RDONLY, O_DIRECTORY, O_CLOEXEC
+  #include <format>        // std::format
+  #include <sys/syscall.h> // SYS_getdents64
+  #include <unistd.h>      // close, pread, syscall
+  #include <utility>       // std::{exchange, move}
+
+  #include <Drac++/Utils/Error.hpp>
+  #include <Drac++/Utils/Types.hpp>
+
+namespace draconis::core::system::linux::sysfs {
+  namespace {
+    using draconis::utils::error::DracError;
+    using enum draconis::utils::error::DracErrorCode;
+
+    using draconis::utils::types::Array;
+    using draconis::utils::types::Err;
+    using draconis::utils::types::i32;
+    using draconis::utils::types::isize;
+    using draconis::utils::types::None;
+    using draconis::utils::types::Option;
+    using draconis::utils::types::PCStr;
+    using draconis::utils::types::Result;
+    using draconis::utils::types::Span;
+    using draconis::utils::types::String;
+    using draconis::utils::types::StringView;
+    using draconis::utils::types::u16;
+    using draconis::utils::types::u64;
+    using draconis::utils::types::u8;
+    using draconis::utils::types::usize;
+  } // namespace
+
+  /// Sysfs attributes are at most a page long, and procfs files we read fit comfortably too.
+  inline constexpr usize FILE_BUFFER_SIZE = 4096;
+
+  using FileBuffer = Array<char, FILE_BUFFER_SIZE>;
+
+  /**
+   * @brief Strips trailing whitespace (including the newline sysfs attributes end with).
+   */
+  constexpr fn TrimEnd(StringView text) -> StringView {
+    const usize end = text.find_last_not_of(" \t\n\r");
+    return end == StringView::npos ? StringView {} : text.substr(0, end + 1);
+  }
+
+  /**
+   * @brief Parses all of @p text as an integer, or returns None.
+   */
+  template <std::integral T>
+  constexpr fn ParseInt(const StringView text, const i32 base = 10) -> Option<T> {
+    T value;
+
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value, base);
+
+    if (ec == std::errc() && ptr == text.data() + text.size())
+      return value;
+
+    return None;
+  }
+
+  /**
+   * @brief Owns a file descriptor and closes it on destruction.
+   */
+  class FileDescriptor {
+   public:
+    FileDescriptor() = default;
+
+    explicit FileDescriptor(const i32 descriptor) : m_fd(descriptor) {}
+
+    ~FileDescriptor() {
+      if (m_fd >= 0)
+        ::close(m_fd);
+    }
+
+    FileDescriptor(const FileDescriptor&)                = delete;
+    fn operator=(const FileDescriptor&)->FileDescriptor& = delete;
+
+    FileDescriptor(FileDescriptor&& other) noexcept : m_fd(std::exchange(other.m_fd, -1)) {}
+
+    fn operator=(FileDescriptor&& other) noexcept -> FileDescriptor& {
+      if (this != &other) {
+        if (m_fd >= 0)
+          ::close(m_fd);
+
+        m_fd = std::exchange(other.m_fd, -1);
+      }
+
+      return *this;
+    }
+
+    [[nodiscard]] explicit operator bool() const {
+      return m_fd >= 0;
+    }
+
+    [[nodiscard]] fn get() const -> i32 {
+      return m_fd;
+    }
+
+   private:
+    i32 m_fd = -1;
+  };
+
+  /**
+   * @brief A directory opened once, that files are then read relative to.
+   *
+   * @details Intended to be kept in a function-local static for directories
+   * like /sys/class/dmi/id that are read over and over. If the directory
+   * couldn't be opened, every read fails with the error from that attempt.
+   */
+  class Directory {
+   public:
+    /**
+     * @param path Absolute path; must outlive the Directory (a string literal, normally).
+     */
+    explicit Directory(const PCStr path)
+      : m_fd(::open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC)), m_path(path), m_openErrno(m_fd ? 0 : errno) {}
+
+    [[nodiscard]] explicit operator bool() const {
+      return static_cast<bool>(m_fd);
+    }
+
+    [[nodiscard]] fn fd() const -> i32 {
+      return m_fd.get();
+    }
+
+    /**
+     * @brief Opens the subdirectory @p name, e.g. one entry of /sys/class/power_supply.
+     */
+    [[nodiscard]] fn open(const PCStr name) const -> Result<Directory> {
+      if (!m_fd)
+        return openError(m_path, m_openErrno);
+
+      FileDescriptor descriptor(::openat(m_fd.get(), name, O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+
+      if (!descriptor)
+        return openError(name, errno);
+
+      return Directory(std::move(descriptor), m_path);
+    }
+
+    /**
+     * @brief Reads the start of file @p name into @p buffer.
+     * @return The bytes read; at most buffer.size(), so longer files are cut off.
+     */
+    fn read(const PCStr name, const Span<char> buffer) const -> Result<StringView> {
+      if (!m_fd)
+        return openError(m_path, m_openErrno);
+
+      const FileDescriptor file(::openat(m_fd.get(), name, O_RDONLY | O_CLOEXEC));
+
+      if (!file)
+        return openError(name, errno);
+
+      isize bytesRead = 0;
+
+      do
+        bytesRead = ::pread(file.get(), buffer.data(), buffer.size(), 0);
+      while (bytesRead < 0 && errno == EINTR);
+
+      if (bytesRead < 0)
+        ERR_FMT(IoError, "Failed to read '{}' in {}: {}", name, m_path, std::strerror(errno));
+
+      return StringView(buffer.data(), static_cast<usize>(bytesRead));
+    }
+
+    /**
+     * @brief Reads the first line of file @p name, without trailing whitespace.
+     * @return A ParseError if the line is empty.
+     */
+    fn readLine(const PCStr name, const Span<char> buffer) const -> Result<StringView> {
+      Result<StringView> contents = read(name, buffer);
+
+      if (!contents)
+        return contents;
+
+      const StringView line = TrimEnd(contents->substr(0, contents->find('\n')));
+
+      if (line.empty())
+        ERR_FMT(ParseError, "'{}' in {} is empty", name, m_path);
+
+      return line;
+    }
+
+    /**
+     * @brief Reads file @p name as a single integer, like most numeric sysfs attributes.
+     */
+    template <std::integral T>
+    fn readInt(const PCStr name, const i32 base = 10) const -> Result<T> {
+      Array<char, 32> buffer;
+
+      Result<StringView> line = readLine(name, buffer);
+
+      if (!line)
+        return Err(std::move(line).error());
+
+      StringView digits = *line;
+
+      if (base == 16 && digits.starts_with("0x"))
+        digits.remove_prefix(2);
+
+      if (Option<T> value = ParseInt<T>(digits, base))
+        return *value;
+
+      ERR_FMT(ParseError, "'{}' in {} is not an integer", name, m_path);
+    }
+
+    /**
+     * @brief Calls @p visit with each line of file @p name until it returns true.
+     *
+     * @details Reads in FILE_BUFFER_SIZE chunks, so files of any length work.
+     * A line longer than a chunk is passed to @p visit in pieces.
+     */
+    template <typename F>
+    fn forEachLine(const PCStr name, F&& visit) const -> Result<> {
+      if (!m_fd)
+        return openError(m_path, m_openErrno);
+
+      const FileDescriptor file(::openat(m_fd.get(), name, O_RDONLY | O_CLOEXEC));
+
+      if (!file)
+        return openError(name, errno);
+
+      FileBuffer buffer;
+      usize      kept   = 0; // Bytes of an unfinished line carried over from the last chunk.
+      off_t      offset = 0;
+
+      while (true) {
+        const isize bytesRead = ::pread(file.get(), buffer.data() + kept, buffer.size() - kept, offset);
+
+        if (bytesRead < 0) {
+          if (errno == EINTR)
+            continue;
+
+          ERR_FMT(IoError, "Failed to read '{}' in {}: {}", name, m_path, std::strerror(errno));
+        }
+
+        if (bytesRead == 0) {
+          if (kept > 0)
+            visit(StringView(buffer.data(), kept));
+
+          return {};
+        }
+
+        offset += bytesRead;
+
+        const usize filled = kept + static_cast<usize>(bytesRead);
+        usize       start  = 0;
+
+        for (usize end = start; end < filled; ++end)
+          if (buffer.at(end) == '\n') {
+            if (visit(StringView(buffer.data() + start, end - start)))
+              return {};
+
+            start = end + 1;
+          }
+
+        if (start == 0 && filled == buffer.size()) {
+          // No newline in a whole chunk; hand it over as it is.
+          if (visit(StringView(buffer.data(), filled)))
+            return {};
+
+          kept = 0;
+        } else {
+          kept = filled - start;
+          std::memmove(buffer.data(), buffer.data() + start, kept);
+        }
+      }
+    }
+
+    /**
+     * @brief Calls @p visit with the name of each entry (other than . and ..) until it returns true.
+     * @return Whether @p visit stopped the iteration.
+     */
+    template <typename F>
+    fn forEachEntry(F&& visit) const -> Result<bool> {
+      if (!m_fd)
+        return openError(m_path, m_openErrno);
+
+      // A separate descriptor so concurrent iterations don't share a directory offset.
+      const FileDescriptor listing(::openat(m_fd.get(), ".", O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+
+      if (!listing)
+        return openError(m_path, errno);
+
+      // Matches the kernel's struct linux_dirent64; glibc doesn't declare it.
+      struct DirectoryEntry {
+        u64  inode;
+        u64  offset;
+        u16  length;
+        u8   type;
+        char name[1]; // NOLINT(*-avoid-c-arrays) - variable-length, NUL-terminated
+      };
+
+      alignas(DirectoryEntry) FileBuffer buffer;
+
+      while (true) {
+        const isize bytesRead = ::syscall(SYS_getdents64, listing.get(), buffer.data(), buffer.size());
+
+        if (bytesRead < 0)
+          ERR_FMT(IoError, "Failed to list {}: {}", m_path, std::strerror(errno));
+
+        if (bytesRead == 0)
+          return false;
+
+        for (isize position = 0; position < bytesRead;) {
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) - getdents64 packs entries into the buffer
+          const auto* entry = reinterpret_cast<const DirectoryEntry*>(buffer.data() + position);
+          position += entry->length;
+
+          const StringView entryName = &entry->name[0];
+
+          if (entryName == "." || entryName == "..")
+            continue;
+
+          if (visit(entryName))
+            return true;
+        }
+      }
+    }
+
+   private:
+    Directory(FileDescriptor descriptor, const PCStr path)
+      : m_fd(std::move(descriptor)), m_path(path) {}
+
+    fn openError(const PCStr name, const i32 err) const -> Err<DracError> {
+      // The directory itself failing to open is reported without repeating its path.
+      const String target = name == m_path ? std::format("'{}'", m_path) : std::format("'{}' in {}", name, m_path);
+
+      if (err == EACCES)
+        return Err(DracError(PermissionDenied, std::format("Permission denied opening {}", target)));
+
+      if (err == ENOENT || err == ENOTDIR)
+        return Err(DracError(NotFound, std::format("{} not found", target)));
+
+      return Err(DracError(IoError, std::format("Failed to open {}: {}", target, std::strerror(err))));
+    }
+
+    FileDescriptor m_fd;
+    PCStr          m_path;          ///< For error messages; subdirectories report their parent's path.
+    i32            m_openErrno = 0; ///< Why the root directory couldn't be opened, if it couldn't.
+  };
+} // namespace draconis::core::system::linux::sysfs
+
+#endif // __linux__
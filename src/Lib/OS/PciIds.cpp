@@ -0,0 +1,265 @@
+#include "PciIds.hpp"
+
+#include <algorithm> // std::{min, ranges::sort}
+#include <charconv>  // std::from_chars
+#include <cstring>   // std::memcpy
+#include <format>    // std::format
+#include <limits>    // std::numeric_limits
+
+#include <Drac++/Utils/Error.hpp>
+
+using enum draconis::utils::error::DracErrorCode;
+
+namespace draconis::core::system::pci {
+  namespace {
+    using utils::types::Array;
+    using utils::types::None;
+    using utils::types::Option;
+    using utils::types::u32;
+    using utils::types::Unit;
+    using utils::types::usize;
+    using utils::types::Vec;
+
+    constexpr Array<char, 8> INDEX_MAGIC = { 'D', 'R', 'A', 'C', 'P', 'C', 'I', '1' };
+
+    struct IndexHeader {
+      Array<char, 8> magic;
+      u32            vendorCount;
+      u32            deviceCount;
+      u32            namesSize;
+      u32            reserved;
+    };
+
+    struct VendorEntry {
+      u16 id;
+      u16 nameLength;
+      u32 nameOffset;
+      u32 firstDevice; ///< Index of the vendor's first DeviceEntry.
+      u32 deviceCount;
+    };
+
+    struct DeviceEntry {
+      u16 id;
+      u16 nameLength;
+      u32 nameOffset;
+    };
+
+    static_assert(sizeof(IndexHeader) == 24);
+    static_assert(sizeof(VendorEntry) == 16);
+    static_assert(sizeof(DeviceEntry) == 8);
+
+    template <typename T>
+    fn ReadPod(const StringView bytes, const usize offset) -> T {
+      T value;
+      std::memcpy(&value, bytes.data() + offset, sizeof(T));
+      return value;
+    }
+
+    template <typename T>
+    fn AppendPod(String& out, const T& value) -> Unit {
+      out.append(reinterpret_cast<const char*>(&value), sizeof(T)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    /**
+     * @brief Splits "xxxx  Name" into its ID and name, if it has that shape.
+     */
+    fn ParseEntryLine(const StringView line) -> Option<Pair<u16, StringView>> {
+      if (line.size() < 7 || line.substr(4, 2) != "  ")
+        return None;
+
+      Result<u16> id = ParseId(line.substr(0, 4));
+
+      if (!id)
+        return None;
+
+      return Pair(*id, line.substr(6));
+    }
+
+    /**
+     * @brief Binary search over the @p count entries of type T starting at @p offset.
+     */
+    template <typename T>
+    fn FindEntry(const StringView index, const usize offset, const u32 count, const u16 id) -> Option<T> {
+      u32 low = 0, high = count;
+
+      while (low < high) {
+        const u32 mid   = low + ((high - low) / 2);
+        const T   entry = ReadPod<T>(index, offset + (static_cast<usize>(mid) * sizeof(T)));
+
+        if (entry.id == id)
+          return entry;
+
+        if (entry.id < id)
+          low = mid + 1;
+        else
+          high = mid;
+      }
+
+      return None;
+    }
+  } // namespace
+
+  fn ParseId(StringView text) -> Result<u16> {
+    if (text.starts_with("0x") || text.starts_with("0X"))
+      text.remove_prefix(2);
+
+    u16 value = 0;
+
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value, 16);
+
+    if (text.empty() || ec != std::errc() || ptr != text.data() + text.size())
+      ERR_FMT(ParseError, "'{}' is not a PCI ID", text);
+
+    return value;
+  }
+
+  fn ParseDevices(const StringView pciIds) -> Vec<DeviceName> {
+    Vec<DeviceName> devices;
+    Option<Pair<u16, StringView>> vendor;
+
+    for (usize start = 0; start < pciIds.size();) {
+      const usize      end  = std::min(pciIds.find('\n', start), pciIds.size());
+      const StringView line = pciIds.substr(start, end - start);
+
+      start = end + 1;
+
+      if (line.empty() || line.front() == '#')
+        continue;
+
+      if (line.front() != '\t')
+        // Anything that isn't a vendor (the "C xx" class list, mostly) ends the current vendor.
+        vendor = ParseEntryLine(line);
+      else if (vendor && line.size() > 1 && line[1] != '\t')
+        if (const Option<Pair<u16, StringView>> device = ParseEntryLine(line.substr(1)))
+          devices.push_back({ vendor->first, device->first, vendor->second, device->second });
+    }
+
+    return devices;
+  }
+
+  fn BuildIndex(const StringView pciIds) -> Result<String> {
+    Vec<VendorEntry> vendors;
+    Vec<DeviceEntry> devices;
+    String           names;
+
+    // A name longer than a u16 would be a corrupt file; cut it rather than fail the whole index.
+    const fn addName = [&names](const StringView name) -> Pair<u32, u16> {
+      const StringView kept = name.substr(0, std::numeric_limits<u16>::max());
+
+      const u32 offset = static_cast<u32>(names.size());
+      names.append(kept);
+
+      return { offset, static_cast<u16>(kept.size()) };
+    };
+
+    // Devices come grouped under their vendor, so a new vendor starts whenever the vendor line changes.
+    for (const DeviceName& device : ParseDevices(pciIds)) {
+      if (vendors.empty() || vendors.back().id != device.vendorId) {
+        const auto [nameOffset, nameLength] = addName(device.vendor);
+        vendors.push_back({ device.vendorId, nameLength, nameOffset, static_cast<u32>(devices.size()), 0 });
+      }
+
+      const auto [nameOffset, nameLength] = addName(device.device);
+      devices.push_back({ device.deviceId, nameLength, nameOffset });
+      ++vendors.back().deviceCount;
+    }
+
+    if (vendors.empty())
+      ERR(ParseError, "No devices found in pci.ids");
+
+    for (const VendorEntry& vendor : vendors) {
+      const auto first = devices.begin() + vendor.firstDevice;
+      std::ranges::sort(first, first + vendor.deviceCount, {}, &DeviceEntry::id);
+    }
+
+    // Each vendor carries its own device range, so the vendors can be reordered freely.
+    std::ranges::sort(vendors, {}, &VendorEntry::id);
+
+    const IndexHeader header {
+      .magic       = INDEX_MAGIC,
+      .vendorCount = static_cast<u32>(vendors.size()),
+      .deviceCount = static_cast<u32>(devices.size()),
+      .namesSize   = static_cast<u32>(names.size()),
+      .reserved    = 0,
+    };
+
+    String index;
+    index.reserve(sizeof(IndexHeader) + (vendors.size() * sizeof(VendorEntry)) + (devices.size() * sizeof(DeviceEntry)) + names.size());
+
+    AppendPod(index, header);
+
+    for (const VendorEntry& vendor : vendors)
+      AppendPod(index, vendor);
+
+    for (const DeviceEntry& device : devices)
+      AppendPod(index, device);
+
+    index.append(names);
+
+    return index;
+  }
+
+  fn Lookup(const StringView index, const u16 vendorId, const u16 deviceId) -> Result<Pair<StringView, StringView>> {
+    if (index.size() < sizeof(IndexHeader))
+      ERR(CorruptedData, "PCI ID index is truncated");
+
+    const auto header = ReadPod<IndexHeader>(index, 0);
+
+    const usize vendorsOffset = sizeof(IndexHeader);
+    const usize devicesOffset = vendorsOffset + (static_cast<usize>(header.vendorCount) * sizeof(VendorEntry));
+    const usize namesOffset   = devicesOffset + (static_cast<usize>(header.deviceCount) * sizeof(DeviceEntry));
+
+    if (header.magic != INDEX_MAGIC || namesOffset + header.namesSize > index.size())
+      ERR(CorruptedData, "PCI ID index has an unexpected layout");
+
+    const StringView names = index.substr(namesOffset, header.namesSize);
+
+    const fn nameAt = [&names](const u32 offset, const u16 length) -> Option<StringView> {
+      if (static_cast<usize>(offset) + length > names.size())
+        return None;
+
+      return names.substr(offset, length);
+    };
+
+    const Option<VendorEntry> vendor = FindEntry<VendorEntry>(index, vendorsOffset, header.vendorCount, vendorId);
+
+    if (!vendor)
+      ERR_FMT(NotFound, "PCI vendor {:04x} not found in pci.ids", vendorId);
+
+    if (static_cast<usize>(vendor->firstDevice) + vendor->deviceCount > header.deviceCount)
+      ERR(CorruptedData, "PCI ID index has an out-of-range device list");
+
+    const Option<DeviceEntry> device = FindEntry<DeviceEntry>(
+      index, devicesOffset + (static_cast<usize>(vendor->firstDevice) * sizeof(DeviceEntry)), vendor->deviceCount, deviceId
+    );
+
+    if (!device)
+      ERR_FMT(NotFound, "PCI device {:04x}:{:04x} not found in pci.ids", vendorId, deviceId);
+
+    const Option<StringView> vendorName = nameAt(vendor->nameOffset, vendor->nameLength);
+    const Option<StringView> deviceName = nameAt(device->nameOffset, device->nameLength);
+
+    if (!vendorName || !deviceName)
+      ERR(CorruptedData, "PCI ID index has an out-of-range name");
+
+    return Pair(*vendorName, *deviceName);
+  }
+
+  fn LookupLinked(const LinkedTable& table, const u16 vendorId, const u16 deviceId) -> Result<Pair<StringView, StringView>> {
+    const u32 key = (static_cast<u32>(vendorId) << 16U) | deviceId;
+
+    if (table.seeds.empty() || table.slots.empty())
+      ERR_FMT(NotFound, "PCI device {:04x}:{:04x} not found in an empty pci.ids table", vendorId, deviceId);
+
+    const u32         seed = table.seeds[HashId(key, 0) % table.seeds.size()];
+    const LinkedSlot& slot = table.slots[HashId(key, seed) % table.slots.size()];
+
+    // Every key in the table hashes to its own slot, so one comparison settles it.
+    if (slot.vendor == LinkedSlot::EMPTY_SLOT || slot.key != key)
+      ERR_FMT(NotFound, "PCI device {:04x}:{:04x} not found in the linked pci.ids table", vendorId, deviceId);
+
+    const LinkedVendor& vendor = table.vendors[slot.vendor];
+
+    return Pair(table.names.substr(vendor.nameOffset, vendor.nameLength), table.names.substr(slot.deviceNameOffset, slot.deviceNameLength));
+  }
+} // namespace draconis::core::system::pci
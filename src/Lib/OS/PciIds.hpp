@@ -0,0 +1,132 @@
+/**
+ * @file PciIds.hpp
+ * @brief Compact binary index of pci.ids for vendor/device name lookups.
+ *
+ * pci.ids is ~1.3 MB of text, and scanning it line by line for every GPU is
+ * most of the cost of the GPU readout on a cold cache. The index is built from
+ * it once, stored in the cache, and then searched in place.
+ *
+ * Index layout (native byte order):
+ * @code
+ *   IndexHeader  { magic "DRACPCI1", vendorCount, deviceCount, namesSize, reserved }
+ *   VendorEntry  { id, nameLength, nameOffset, firstDevice, deviceCount } x vendorCount, sorted by id
+ *   DeviceEntry  { id, nameLength, nameOffset }                           x deviceCount, sorted by id within each vendor
+ *   names        concatenated, not terminated; offsets are relative to the start of this block
+ * @endcode
+ *
+ * Only vendor and device lines are indexed; subsystems and the device class
+ * list at the end of the file are skipped.
+ *
+ * Builds with DRAC_USE_LINKED_PCI_IDS don't parse pci.ids at runtime at all.
+ * PciTableGen turns it into a perfect-hash table at build time instead, which
+ * LookupLinked() searches.
+ */
+
+#pragma once
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+namespace draconis::core::system::pci {
+  namespace {
+    using utils::types::Pair;
+    using utils::types::Result;
+    using utils::types::Span;
+    using utils::types::String;
+    using utils::types::StringView;
+    using utils::types::u16;
+    using utils::types::u32;
+    using utils::types::Vec;
+  } // namespace
+
+  /**
+   * @brief One device line of pci.ids, with the vendor it's listed under.
+   */
+  struct DeviceName {
+    u16        vendorId;
+    u16        deviceId;
+    StringView vendor;
+    StringView device;
+  };
+
+  /**
+   * @brief Every device in the text of pci.ids, in file order.
+   * @return Views into @p pciIds.
+   */
+  fn ParseDevices(StringView pciIds) -> Vec<DeviceName>;
+
+  /**
+   * @brief Builds an index from the text of pci.ids.
+   * @return The index, or a ParseError if @p pciIds has no devices in it.
+   */
+  fn BuildIndex(StringView pciIds) -> Result<String>;
+
+  /**
+   * @brief Looks up the vendor and device names for an ID pair.
+   * @param index An index made by BuildIndex().
+   * @return Views into @p index, a NotFound error if either ID is unknown, or
+   * CorruptedData if @p index isn't a valid index.
+   */
+  fn Lookup(StringView index, u16 vendorId, u16 deviceId) -> Result<Pair<StringView, StringView>>;
+
+  /**
+   * @brief Parses a vendor or device ID as sysfs prints it ("0x10de") or pci.ids writes it ("10de").
+   */
+  fn ParseId(StringView text) -> Result<u16>;
+
+  /**
+   * @brief Slot of the perfect-hash table generated by PciTableGen.
+   */
+  struct LinkedSlot {
+    u32 key;              ///< (vendorId << 16) | deviceId
+    u32 deviceNameOffset; ///< Into the names block.
+    u16 deviceNameLength;
+    u16 vendor;           ///< Index into the vendor table, or EMPTY_SLOT.
+
+    static constexpr u16 EMPTY_SLOT = 0xFFFF;
+  };
+
+  struct LinkedVendor {
+    u32 nameOffset;
+    u16 nameLength;
+  };
+
+  /**
+   * @brief A perfect-hash table, either the one generated into the build or one BuildTable() made at runtime.
+   */
+  struct LinkedTable {
+    Span<const u32>          seeds;
+    Span<const LinkedSlot>   slots;
+    Span<const LinkedVendor> vendors;
+    StringView               names;
+  };
+
+  /**
+   * @brief Looks up the vendor and device names in @p table.
+   * @return Views into @p table's names, or a NotFound error.
+   */
+  fn LookupLinked(const LinkedTable& table, u16 vendorId, u16 deviceId) -> Result<Pair<StringView, StringView>>;
+
+  /**
+   * @brief Hash used by the generated table; seed 0 picks the bucket, the bucket's seed picks the slot.
+   */
+  constexpr fn HashId(const u32 key, const u32 seed) -> u32 {
+    u32 hash = key ^ (seed * 0x9E3779B9U);
+
+    hash ^= hash >> 16U;
+    hash *= 0x7FEB352DU;
+    hash ^= hash >> 15U;
+    hash *= 0x846CA68BU;
+    hash ^= hash >> 16U;
+
+    return hash;
+  }
+
+#if DRAC_USE_LINKED_PCI_IDS
+  /**
+   * @brief Looks up the vendor and device names in the table generated from pci.ids at build time.
+   * @return Views into static storage, or a NotFound error.
+   */
+  fn LookupLinked(u16 vendorId, u16 deviceId) -> Result<Pair<StringView, StringView>>;
+#endif
+} // namespace draconis::core::system::pci
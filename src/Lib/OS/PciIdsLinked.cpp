@@ -0,0 +1,11 @@
+#include "PciIds.hpp"
+
+#include "PciIdsTable.hpp" // Generated by pci-table-gen; see src/Lib/meson.build.
+
+namespace draconis::core::system::pci {
+  fn LookupLinked(const u16 vendorId, const u16 deviceId) -> Result<Pair<StringView, StringView>> {
+    using namespace linked;
+
+    return LookupLinked({ .seeds = SEEDS, .slots = SLOTS, .vendors = VENDORS, .names = NAMES }, vendorId, deviceId);
+  }
+} // namespace draconis::core::system::pci
@@ -0,0 +1,231 @@
+#include "PciTable.hpp"
+
+#include <algorithm> // std::ranges::{contains, sort}
+#include <format>    // std::{format, format_to}
+#include <iterator>  // std::back_inserter
+#include <limits>    // std::numeric_limits
+
+#include <Drac++/Utils/Error.hpp>
+
+using draconis::utils::error::DracError;
+using enum draconis::utils::error::DracErrorCode;
+
+namespace draconis::core::system::pci {
+  namespace {
+    using utils::types::Array;
+    using utils::types::Err;
+    using utils::types::Pair;
+    using utils::types::u16;
+    using utils::types::u8;
+    using utils::types::UnorderedSet;
+    using utils::types::usize;
+
+    // clang-format off
+    /// GPU vendors (including the virtual ones hypervisors present) kept by --display-only.
+    constexpr Array<u16, 16> DISPLAY_VENDORS = {
+      0x1002, // AMD/ATI
+      0x1013, // Cirrus Logic (emulated by QEMU)
+      0x102b, // Matrox
+      0x10de, // NVIDIA
+      0x1234, // QEMU/Bochs
+      0x13b5, // ARM
+      0x1414, // Microsoft (Hyper-V)
+      0x15ad, // VMware
+      0x1a03, // ASPEED
+      0x1af4, // Red Hat (virtio-gpu)
+      0x1b36, // Red Hat (QXL)
+      0x1d17, // Zhaoxin
+      0x1ed5, // Moore Threads
+      0x5143, // Qualcomm
+      0x80ee, // VirtualBox
+      0x8086, // Intel
+    };
+    // clang-format on
+
+    /// Seeds tried per bucket before giving up. With four keys per bucket at ~90% load the
+    /// first few dozen nearly always do; the cap only turns a hopeless search into an error.
+    constexpr u32 MAX_SEED = 1U << 24U;
+
+    fn KeyOf(const DeviceName& device) -> u32 {
+      return (static_cast<u32>(device.vendorId) << 16U) | device.deviceId;
+    }
+
+    /**
+     * @brief Writes @p bytes as adjacent string literals, escaping anything that isn't plain printable ASCII.
+     */
+    fn WriteStringLiteral(String& out, const StringView bytes) -> Unit {
+      constexpr usize LINE_LENGTH = 100;
+
+      usize lineStart = out.size();
+
+      out += "    \"";
+
+      for (const char byte : bytes) {
+        const auto value = static_cast<u8>(byte);
+
+        // Octal escapes are at most three digits, so unlike \x they can't swallow the next character.
+        if (value < 0x20 || value >= 0x7F || byte == '"' || byte == '\\')
+          std::format_to(std::back_inserter(out), "\\{:03o}", value);
+        else
+          out += byte;
+
+        if (out.size() - lineStart >= LINE_LENGTH) {
+          out += "\"\n";
+          lineStart = out.size();
+          out += "    \"";
+        }
+      }
+
+      out += "\"";
+    }
+  } // namespace
+
+  fn KeepDisplayVendors(Vec<DeviceName>& devices) -> Unit {
+    std::erase_if(devices, [](const DeviceName& device) { return !std::ranges::contains(DISPLAY_VENDORS, device.vendorId); });
+  }
+
+  fn BuildTable(const Vec<DeviceName>& devices) -> Result<Table> {
+    Table table;
+
+    const fn addName = [&table](const StringView name) -> Pair<u32, u16> {
+      const StringView kept   = name.substr(0, std::numeric_limits<u16>::max());
+      const u32        offset = static_cast<u32>(table.names.size());
+
+      table.names.append(kept);
+
+      return { offset, static_cast<u16>(kept.size()) };
+    };
+
+    // Fill in every entry first; hashing only decides where each one goes.
+    Vec<LinkedSlot>   entries;
+    UnorderedSet<u32> seen;
+
+    for (const DeviceName& device : devices) {
+      // pci.ids shouldn't repeat an ID, but a repeat would make the hash impossible.
+      if (!seen.insert(KeyOf(device)).second)
+        continue;
+
+      // Devices come grouped under their vendor, so a new vendor starts whenever the vendor line changes.
+      if (entries.empty() || (entries.back().key >> 16U) != device.vendorId) {
+        const auto [nameOffset, nameLength] = addName(device.vendor);
+        table.vendors.push_back({ .nameOffset = nameOffset, .nameLength = nameLength });
+      }
+
+      const auto [nameOffset, nameLength] = addName(device.device);
+
+      entries.push_back({
+        .key              = KeyOf(device),
+        .deviceNameOffset = nameOffset,
+        .deviceNameLength = nameLength,
+        .vendor           = static_cast<u16>(table.vendors.size() - 1),
+      });
+    }
+
+    if (entries.empty())
+      return Err(DracError(ParseError, "No devices found in pci.ids"));
+
+    if (table.vendors.size() >= LinkedSlot::EMPTY_SLOT)
+      return Err(DracError(ParseError, "Too many vendors in pci.ids for the table format"));
+
+    // ~90% load keeps the displacement search quick while wasting little space.
+    const usize slotCount   = (entries.size() * 10 / 9) + 1;
+    const usize bucketCount = std::max<usize>(entries.size() / 4, 1);
+
+    Vec<Vec<usize>> buckets(bucketCount);
+
+    for (usize i = 0; i < entries.size(); ++i)
+      buckets[HashId(entries[i].key, 0) % bucketCount].push_back(i);
+
+    // Fullest buckets first, while most slots are still free.
+    Vec<usize> order(bucketCount);
+
+    for (usize i = 0; i < bucketCount; ++i)
+      order[i] = i;
+
+    std::ranges::sort(order, [&buckets](const usize lhs, const usize rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+    table.seeds.assign(bucketCount, 0);
+    table.slots.assign(slotCount, { .key = 0, .deviceNameOffset = 0, .deviceNameLength = 0, .vendor = LinkedSlot::EMPTY_SLOT });
+
+    Vec<usize> positions;
+
+    for (const usize bucket : order) {
+      if (buckets[bucket].empty())
+        break;
+
+      u32 seed = 1;
+
+      for (; seed < MAX_SEED; ++seed) {
+        positions.clear();
+
+        bool fits = true;
+
+        for (const usize entry : buckets[bucket]) {
+          const usize position = HashId(entries[entry].key, seed) % slotCount;
+
+          if (table.slots[position].vendor != LinkedSlot::EMPTY_SLOT || std::ranges::contains(positions, position)) {
+            fits = false;
+            break;
+          }
+
+          positions.push_back(position);
+        }
+
+        if (fits)
+          break;
+      }
+
+      if (seed == MAX_SEED)
+        return Err(DracError(InternalError, std::format("No seed places bucket {} without collisions", bucket)));
+
+      table.seeds[bucket] = seed;
+
+      for (usize i = 0; i < positions.size(); ++i)
+        table.slots[positions[i]] = entries[buckets[bucket][i]];
+    }
+
+    return table;
+  }
+
+  fn RenderTable(const Table& table, const StringView source) -> String {
+    String out;
+
+    std::format_to(std::back_inserter(out), "// Generated by pci-table-gen from {}. Do not edit.\n\n", source);
+
+    out += "#pragma once\n\n";
+    out += "#include \"OS/PciIds.hpp\"\n\n";
+    out += "namespace draconis::core::system::pci::linked {\n";
+    out += "  using draconis::utils::types::Array;\n\n";
+
+    std::format_to(std::back_inserter(out), "  inline constexpr Array<u32, {}> SEEDS = {{\n", table.seeds.size());
+
+    for (const u32 seed : table.seeds)
+      std::format_to(std::back_inserter(out), "    {},\n", seed);
+
+    out += "  };\n\n";
+
+    std::format_to(std::back_inserter(out), "  inline constexpr Array<LinkedSlot, {}> SLOTS = {{ {{\n", table.slots.size());
+
+    for (const LinkedSlot& slot : table.slots)
+      std::format_to(std::back_inserter(out), "    {{ {:#010x}, {}, {}, {} }},\n", slot.key, slot.deviceNameOffset, slot.deviceNameLength, slot.vendor);
+
+    out += "  } };\n\n";
+
+    std::format_to(std::back_inserter(out), "  inline constexpr Array<LinkedVendor, {}> VENDORS = {{ {{\n", table.vendors.size());
+
+    for (const LinkedVendor& vendor : table.vendors)
+      std::format_to(std::back_inserter(out), "    {{ {}, {} }},\n", vendor.nameOffset, vendor.nameLength);
+
+    out += "  } };\n\n";
+
+    out += "  inline constexpr char NAMES_DATA[] = // NOLINT(*-avoid-c-arrays)\n";
+    WriteStringLiteral(out, table.names);
+    out += ";\n\n";
+    out += "  inline constexpr StringView NAMES(NAMES_DATA, sizeof(NAMES_DATA) - 1);\n\n";
+    std::format_to(std::back_inserter(out), "  static_assert(NAMES.size() == {});\n", table.names.size());
+
+    out += "} // namespace draconis::core::system::pci::linked\n";
+
+    return out;
+  }
+} // namespace draconis::core::system::pci
@@ -0,0 +1,59 @@
+/**
+ * @file PciTable.hpp
+ * @brief Builds the perfect-hash pci.ids table that PciTableGen writes out for DRAC_USE_LINKED_PCI_IDS builds.
+ *
+ * The table is a hash-and-displace perfect hash: every (vendor << 16 | device)
+ * key is put in a bucket by HashId(key, 0), and each bucket gets the first
+ * seed that sends all of its keys to free slots through HashId(key, seed).
+ * A lookup is then two hashes and one key comparison, with no text to parse;
+ * see LookupLinked().
+ */
+
+#pragma once
+
+#include <Drac++/Utils/Types.hpp>
+
+#include "PciIds.hpp"
+
+namespace draconis::core::system::pci {
+  namespace {
+    using utils::types::Result;
+    using utils::types::String;
+    using utils::types::StringView;
+    using utils::types::u32;
+    using utils::types::Unit;
+    using utils::types::Vec;
+  } // namespace
+
+  /**
+   * @brief A table built by BuildTable(), owning its storage.
+   */
+  struct Table {
+    Vec<u32>          seeds;
+    Vec<LinkedSlot>   slots;
+    Vec<LinkedVendor> vendors;
+    String            names;
+
+    [[nodiscard]] fn view() const -> LinkedTable {
+      return { .seeds = seeds, .slots = slots, .vendors = vendors, .names = names };
+    }
+  };
+
+  /**
+   * @brief Drops every device whose vendor doesn't make display hardware (what --display-only keeps).
+   */
+  fn KeepDisplayVendors(Vec<DeviceName>& devices) -> Unit;
+
+  /**
+   * @brief Builds the table from the devices ParseDevices() found.
+   * @return A ParseError if there are no devices or too many vendors, or an
+   * InternalError if no seed places some bucket.
+   */
+  fn BuildTable(const Vec<DeviceName>& devices) -> Result<Table>;
+
+  /**
+   * @brief Renders @p table as the PciIdsTable.hpp header PciIdsLinked.cpp includes.
+   * @param source Where the table came from, for the header comment.
+   */
+  fn RenderTable(const Table& table, StringView source) -> String;
+} // namespace draconis::core::system::pci
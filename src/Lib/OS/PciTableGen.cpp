@@ -0,0 +1,65 @@
+/**
+ * @file PciTableGen.cpp
+ * @brief Build-time tool that turns pci.ids into the perfect-hash table used by DRAC_USE_LINKED_PCI_IDS builds.
+ *
+ * Usage: `pci-table-gen <pci.ids> <output header> [--display-only]`
+ *
+ * See PciTable.hpp for the table format and how it is built.
+ *
+ * With --display-only, only vendors that make display hardware are kept,
+ * which cuts the table down to a small fraction of the full file.
+ */
+
+#include <fstream>  // std::{ifstream, ofstream}
+#include <iterator> // std::istreambuf_iterator
+#include <print>    // std::println
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "PciIds.hpp"
+#include "PciTable.hpp"
+
+using namespace draconis::utils::types;
+using namespace draconis::core::system;
+
+fn main(const i32 argc, char** argv) -> i32 {
+  const Span<char*> args(argv, static_cast<usize>(argc));
+
+  if (args.size() < 3 || args.size() > 4 || (args.size() == 4 && StringView(args[3]) != "--display-only")) {
+    std::println(stderr, "usage: pci-table-gen <pci.ids> <output header> [--display-only]");
+    return 2;
+  }
+
+  std::ifstream input(args[1], std::ios::binary);
+
+  if (!input) {
+    std::println(stderr, "pci-table-gen: cannot open {}", args[1]);
+    return 1;
+  }
+
+  const String pciIds((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+  Vec<pci::DeviceName> devices = pci::ParseDevices(pciIds);
+
+  if (args.size() == 4)
+    pci::KeepDisplayVendors(devices);
+
+  Result<pci::Table> table = pci::BuildTable(devices);
+
+  if (!table) {
+    std::println(stderr, "pci-table-gen: {}", table.error().message);
+    return 1;
+  }
+
+  std::ofstream output(args[2], std::ios::binary | std::ios::trunc);
+
+  output << pci::RenderTable(*table, args[1]);
+
+  if (!output) {
+    std::println(stderr, "pci-table-gen: cannot write {}", args[2]);
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,57 @@
+#include "Readouts.hpp"
+
+#include "Drac++/Core/System.hpp"
+
+#include "Drac++/Utils/CacheManager.hpp"
+#include "Drac++/Utils/Types.hpp"
+
+namespace draconis::core::system {
+  namespace {
+    template <typename T, typename F>
+    fn FillIfRequested(const Readout requested, const Readout readout, Option<Result<T>>& slot, F&& fetch) -> Unit {
+      if (HasReadout(requested, readout) && !slot)
+        slot = std::forward<F>(fetch)();
+    }
+  } // namespace
+
+#ifndef __linux__
+  // No platform but Linux has readouts worth fusing yet.
+  fn detail::CollectSharedSources(CacheManager& /*cache*/, const Readout /*readouts*/, Readouts& /*out*/) -> Unit {}
+#endif
+
+  fn CollectReadouts(CacheManager& cache, const Readout readouts) -> Readouts {
+    Readouts out;
+
+    detail::CollectSharedSources(cache, readouts, out);
+
+    using enum Readout;
+
+    FillIfRequested(readouts, MemInfo, out.memInfo, [&] { return GetMemInfo(cache); });
+    FillIfRequested(readouts, Uptime, out.uptime, [] { return GetUptime(); });
+    FillIfRequested(readouts, OperatingSystem, out.operatingSystem, [&] { return GetOperatingSystem(cache); });
+    FillIfRequested(readouts, DesktopEnvironment, out.desktopEnvironment, [&] { return GetDesktopEnvironment(cache); });
+    FillIfRequested(readouts, WindowManager, out.windowManager, [&] { return GetWindowManager(cache); });
+    FillIfRequested(readouts, Shell, out.shell, [&] { return GetShell(cache); });
+    FillIfRequested(readouts, Host, out.host, [&] { return GetHost(cache); });
+    FillIfRequested(readouts, CPUModel, out.cpuModel, [&] { return GetCPUModel(cache); });
+    FillIfRequested(readouts, CPUCores, out.cpuCores, [&] { return GetCPUCores(cache); });
+    FillIfRequested(readouts, GPUModel, out.gpuModel, [&] { return GetGPUModel(cache); });
+    FillIfRequested(readouts, KernelVersion, out.kernelVersion, [&] { return GetKernelVersion(cache); });
+    FillIfRequested(readouts, DiskUsage, out.diskUsage, [&] { return GetDiskUsage(cache); });
+    FillIfRequested(readouts, Outputs, out.outputs, [&] { return GetOutputs(cache); });
+    FillIfRequested(readouts, PrimaryOutput, out.primaryOutput, [&] { return GetPrimaryOutput(cache); });
+    FillIfRequested(readouts, NetworkInterfaces, out.networkInterfaces, [&] { return GetNetworkInterfaces(cache); });
+    FillIfRequested(readouts, PrimaryNetworkInterface, out.primaryNetworkInterface, [&] { return GetPrimaryNetworkInterface(cache); });
+    FillIfRequested(readouts, Battery, out.battery, [&] { return GetBatteryInfo(cache); });
+
+#if DRAC_ENABLE_NOWPLAYING
+    FillIfRequested(readouts, NowPlaying, out.nowPlaying, [] { return GetNowPlaying(); });
+#endif
+
+#ifdef __linux__
+    FillIfRequested(readouts, DistroID, out.distroId, [&] { return linux::GetDistroID(cache); });
+#endif
+
+    return out;
+  }
+} // namespace draconis::core::system
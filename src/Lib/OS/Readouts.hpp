@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Drac++/Core/System.hpp"
+
+#include "Drac++/Utils/CacheManager.hpp"
+#include "Drac++/Utils/Types.hpp"
+
+namespace draconis::core::system::detail {
+  namespace {
+    using utils::cache::CacheManager;
+
+    using utils::types::Fn;
+    using utils::types::LockGuard;
+    using utils::types::Mutex;
+    using utils::types::Option;
+    using utils::types::Result;
+    using utils::types::Unit;
+  } // namespace
+
+  /**
+   * @brief Reads a source at most once while a CollectReadouts() call is running.
+   *
+   * @details Cache fetchers capture this through a SharedPointer, because the
+   * cache may re-run them on a background thread later. Once the collection is
+   * done it calls close(), after which every get() reads the source afresh, so
+   * a late refresh never sees data from the original collection.
+   */
+  template <typename T>
+  class SharedSource {
+   public:
+    explicit SharedSource(Fn<Result<T>()> read) : m_read(std::move(read)) {}
+
+    fn get() -> Result<T> {
+      LockGuard lock(m_mutex);
+
+      if (!m_open)
+        return m_read();
+
+      if (!m_value)
+        m_value = m_read();
+
+      return *m_value;
+    }
+
+    fn close() -> Unit {
+      LockGuard lock(m_mutex);
+      m_open = false;
+      m_value.reset();
+    }
+
+   private:
+    Mutex             m_mutex;
+    Fn<Result<T>()>   m_read;
+    Option<Result<T>> m_value;
+    bool              m_open = true;
+  };
+
+  /**
+   * @brief Fills whichever of the requested readouts the platform can produce from shared sources.
+   *
+   * @details Implemented per platform; readouts it leaves as None are filled
+   * afterwards by CollectReadouts() through the regular GetX() functions.
+   */
+  fn CollectSharedSources(CacheManager& cache, Readout readouts, Readouts& out) -> Unit;
+} // namespace draconis::core::system::detail
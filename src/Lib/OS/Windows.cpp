@@ -1208,7 +1208,7 @@ namespace draconis::services::packages {
   using helpers::GetDirCount;
 
   fn CountChocolatey(CacheManager& cache) -> Result<u64> {
-    return cache.getOrSet<u64>("windows_chocolatey_count", []() -> Result<u64> {
+    return cache.getOrSet<u64>("pkg_count_chocolatey", []() -> Result<u64> {
       // C:\ProgramData\chocolatey is the default installation directory.
       WString chocoPath = L"C:\\ProgramData\\chocolatey";
 
@@ -1232,7 +1232,7 @@ namespace draconis::services::packages {
   }
 
   fn CountScoop(CacheManager& cache) -> Result<u64> {
-    return cache.getOrSet<u64>("windows_scoop_count", []() -> Result<u64> {
+    return cache.getOrSet<u64>("pkg_count_scoop", []() -> Result<u64> {
       WString scoopAppsPath;
 
       // The SCOOP environment variable should be used first if it's set.
@@ -1260,7 +1260,7 @@ namespace draconis::services::packages {
   }
 
   fn CountWinGet(CacheManager& cache) -> Result<u64> {
-    return cache.getOrSet<u64>("windows_winget_count", []() -> Result<u64> {
+    return cache.getOrSet<u64>("pkg_count_winget", []() -> Result<u64> {
       try {
         using winrt::Windows::Management::Deployment::PackageManager;
 
@@ -30,7 +30,7 @@
   #include "OS/macOS/Bridge.hpp"
 
 using namespace draconis::utils::types;
-using draconis::utils::cache::CacheManager, draconis::utils::cache::CachePolicy;
+using draconis::utils::cache::CacheManager, draconis::utils::cache::CachePolicy, draconis::utils::cache::CacheValidator;
 
 using enum draconis::utils::error::DracErrorCode;
 
@@ -763,7 +763,10 @@ namespace draconis::services::packages {
   namespace fs = std::filesystem;
 
   fn GetHomebrewCount(CacheManager& cache) -> Result<u64> {
-    return cache.getOrSet<u64>("homebrew_total", [&]() -> Result<u64> {
+    // Each formula is a directory directly under the Cellar, so the Cellar's mtime changes on install/uninstall.
+    const CacheValidator validator { .sources = { "/opt/homebrew/Cellar", "/usr/local/Cellar" } };
+
+    return cache.getOrSet<u64>("pkg_count_homebrew", CachePolicy::neverExpire(), validator, []() -> Result<u64> {
       Array<fs::path, 2> cellarPaths {
         "/opt/homebrew/Cellar",
         "/usr/local/Cellar",
@@ -0,0 +1,323 @@
+#ifdef __linux__
+
+  #include <Drac++/Services/ChangeWatcher.hpp>
+
+  #include <algorithm>         // std::ranges::contains
+  #include <cerrno>            // errno, EAGAIN, EINTR, ENOBUFS
+  #include <cstring>           // std::{memcpy, strerror}
+  #include <format>            // std::format
+  #include <linux/netlink.h>   // sockaddr_nl, NETLINK_KOBJECT_UEVENT
+  #include <linux/rtnetlink.h> // RTMGRP_*
+  #include <poll.h>            // poll, pollfd, POLLIN
+  #include <sys/eventfd.h>     // eventfd, EFD_CLOEXEC
+  #include <sys/inotify.h>     // inotify_init1, inotify_add_watch, inotify_event, IN_*
+  #include <sys/socket.h>      // socket, bind, recv
+  #include <unistd.h>          // read, write
+
+  #include <Drac++/Utils/Env.hpp>
+  #include <Drac++/Utils/Error.hpp>
+  #include <Drac++/Utils/Logging.hpp>
+
+  #include "OS/Linux/SysFs.hpp"
+
+using enum draconis::utils::error::DracErrorCode;
+
+namespace draconis::services::watcher {
+  /**
+   * @brief How a FileTarget's name is compared with the entries of its directory.
+   */
+  enum class Match : utils::types::u8 {
+    Exact,    ///< Only the entry called name.
+    Database, ///< name, plus the -wal and -journal files SQLite keeps next to it.
+    Prefix,   ///< Any entry starting with name, e.g. a versioned file; any entry at all if name is empty.
+  };
+
+  /**
+   * @brief Files in a watched directory whose changes invalidate @p keys.
+   */
+  struct FileTarget {
+    String      directory;
+    String      name;
+    Change      change;
+    Vec<String> keys;
+    Match       match = Match::Exact;
+  };
+
+  namespace {
+    using core::system::linux::sysfs::FileDescriptor;
+
+    using utils::env::GetEnv;
+    using utils::types::Array;
+    using utils::types::i32;
+    using utils::types::i64;
+    using utils::types::isize;
+    using utils::types::PCStr;
+    using utils::types::Span;
+    using utils::types::StringView;
+    using utils::types::u32;
+    using utils::types::u64;
+    using utils::types::UnorderedSet;
+    using utils::types::usize;
+
+    using std::chrono::steady_clock;
+
+    /// Cache keys behind each kind of change; kept in step with the readouts in OS/Linux.cpp.
+    constexpr Array<StringView, 2> NETWORK_KEYS = { "linux_network_interfaces", "linux_primary_network_interface" };
+    constexpr Array<StringView, 1> DISPLAY_KEYS = { "linux_gpu_model" };
+    constexpr Array<StringView, 2> OS_KEYS      = { "linux_distro_id", "linux_os_version" };
+
+    constexpr u32 ROUTE_GROUPS = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV4_ROUTE | RTMGRP_IPV6_IFADDR | RTMGRP_IPV6_ROUTE;
+
+    /// The kernel's own uevents; udevd rebroadcasts them on group 2 with its own header.
+    constexpr u32 KERNEL_UEVENT_GROUP = 1;
+
+    constexpr u32 FILE_EVENTS = IN_CLOSE_WRITE | IN_MODIFY | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO;
+
+    fn KeysOf(const Span<const StringView> keys) -> Vec<String> {
+      return { keys.begin(), keys.end() };
+    }
+
+    fn PackageTarget(String directory, String name, const Match match, const StringView packageManager) -> FileTarget {
+      return { std::move(directory), std::move(name), Change::Packages, { std::format("pkg_count_{}", packageManager) }, match };
+    }
+
+    fn Matches(const FileTarget& target, const StringView entry) -> bool {
+      switch (target.match) {
+        case Match::Exact:    return entry == target.name;
+        case Match::Prefix:   return entry.starts_with(target.name);
+        case Match::Database: {
+          if (!entry.starts_with(target.name))
+            return false;
+
+          const StringView suffix = entry.substr(target.name.size());
+          return suffix.empty() || suffix == "-wal" || suffix == "-journal";
+        }
+      }
+
+      return false;
+    }
+
+    fn DefaultFileTargets() -> Vec<FileTarget> {
+      Vec<FileTarget> targets = {
+        // /etc/os-release is usually a symlink to /usr/lib/os-release, and either may be the one replaced.
+        { "/etc", "os-release", Change::OperatingSystem, KeysOf(OS_KEYS) },
+        { "/usr/lib", "os-release", Change::OperatingSystem, KeysOf(OS_KEYS) },
+
+        PackageTarget("/lib/apk/db", "installed", Match::Exact, "apk"),
+        PackageTarget("/var/lib/dpkg/info", "", Match::Prefix, "dpkg"),
+        PackageTarget("/.moss/db", "install", Match::Database, "moss"),
+        PackageTarget("/var/lib/pacman/local", "", Match::Prefix, "pacman"),
+        PackageTarget("/var/lib/rpm", "rpmdb.sqlite", Match::Database, "rpm"),
+        PackageTarget("/var/db/xbps", "pkgdb-", Match::Prefix, "xbps"),
+        PackageTarget("/nix/var/nix/db", "db.sqlite", Match::Database, "nix"),
+      };
+
+      if (const Result<PCStr> cargoHome = GetEnv("CARGO_HOME"))
+        targets.push_back(PackageTarget(std::format("{}/bin", *cargoHome), "", Match::Prefix, "cargo"));
+      else if (const Result<PCStr> homeDir = GetEnv("HOME"))
+        targets.push_back(PackageTarget(std::format("{}/.cargo/bin", *homeDir), "", Match::Prefix, "cargo"));
+
+      return targets;
+    }
+
+    fn OpenNetlink(const i32 protocol, const u32 groups) -> FileDescriptor {
+      FileDescriptor socket(::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, protocol));
+
+      const sockaddr_nl address { .nl_family = AF_NETLINK, .nl_pad = 0, .nl_pid = 0, .nl_groups = groups };
+
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) - sockaddr_nl is a sockaddr
+      if (socket && ::bind(socket.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+        return {};
+
+      return socket;
+    }
+
+    /**
+     * @brief The SUBSYSTEM= value of a kernel uevent ("add@/devices/...\0ACTION=add\0SUBSYSTEM=drm\0...").
+     */
+    fn UeventSubsystem(const StringView message) -> StringView {
+      for (usize start = 0; start < message.size();) {
+        const usize      end   = std::min(message.find('\0', start), message.size());
+        const StringView field = message.substr(start, end - start);
+
+        if (field.starts_with("SUBSYSTEM="))
+          return field.substr(10);
+
+        start = end + 1;
+      }
+
+      return {};
+    }
+  } // namespace
+
+  struct ChangeWatcher::Sources {
+    struct Watch {
+      i32        descriptor;
+      FileTarget target;
+    };
+
+    FileDescriptor stop;    ///< eventfd; written by the destructor to end the thread.
+    FileDescriptor routes;  ///< rtnetlink notifications.
+    FileDescriptor uevents; ///< Kernel uevents.
+    FileDescriptor files;   ///< inotify.
+    Vec<Watch>     watches;
+  };
+
+  fn ChangeWatcher::start(CacheManager& cache, WatcherOptions options) -> Result<UniquePointer<ChangeWatcher>> {
+    auto sources = std::make_unique<Sources>();
+
+    sources->stop = FileDescriptor(::eventfd(0, EFD_CLOEXEC));
+
+    if (!sources->stop)
+      ERR_FMT(ApiUnavailable, "Failed to create an eventfd: {}", std::strerror(errno));
+
+    if (sources->routes = OpenNetlink(NETLINK_ROUTE, ROUTE_GROUPS); !sources->routes)
+      debug_log("ChangeWatcher: no rtnetlink notifications: {}", std::strerror(errno));
+
+    if (sources->uevents = OpenNetlink(NETLINK_KOBJECT_UEVENT, KERNEL_UEVENT_GROUP); !sources->uevents)
+      debug_log("ChangeWatcher: no uevents: {}", std::strerror(errno));
+
+    if (sources->files = FileDescriptor(::inotify_init1(IN_CLOEXEC | IN_NONBLOCK)); !sources->files)
+      debug_log("ChangeWatcher: no inotify: {}", std::strerror(errno));
+
+    if (sources->files) {
+      Vec<FileTarget> targets = DefaultFileTargets();
+
+      for (auto& [path, keys] : options.files)
+        targets.push_back({ path.parent_path().string(), path.filename().string(), Change::File, std::move(keys) });
+
+      options.files.clear();
+
+      // Directories that don't exist belong to package managers that aren't installed.
+      for (FileTarget& target : targets)
+        if (const i32 descriptor = ::inotify_add_watch(sources->files.get(), target.directory.c_str(), FILE_EVENTS | IN_ONLYDIR); descriptor >= 0)
+          sources->watches.push_back({ descriptor, std::move(target) });
+    }
+
+    if (!sources->routes && !sources->uevents && sources->watches.empty())
+      ERR(ApiUnavailable, "None of netlink, uevents or inotify are available to watch for changes");
+
+    return UniquePointer<ChangeWatcher>(new ChangeWatcher(cache, std::move(options), std::move(sources)));
+  }
+
+  ChangeWatcher::ChangeWatcher(CacheManager& cache, WatcherOptions options, UniquePointer<Sources> sources)
+    : m_cache(cache), m_options(std::move(options)), m_sources(std::move(sources)), m_thread([this] { run(); }) {}
+
+  ChangeWatcher::~ChangeWatcher() {
+    const u64 one = 1;
+
+    (void)::write(m_sources->stop.get(), &one, sizeof(one));
+
+    m_thread.join();
+  }
+
+  fn ChangeWatcher::run() -> Unit {
+    Array<pollfd, 4> fds = { {
+      { .fd = m_sources->stop.get(), .events = POLLIN, .revents = 0 },
+      { .fd = m_sources->routes.get(), .events = POLLIN, .revents = 0 },
+      { .fd = m_sources->uevents.get(), .events = POLLIN, .revents = 0 },
+      { .fd = m_sources->files.get(), .events = POLLIN, .revents = 0 },
+    } };
+
+    // Datagrams longer than this are truncated, which is fine: only the start of a uevent is read.
+    alignas(inotify_event) Array<char, 8192> buffer;
+
+    UnorderedSet<String>     pendingKeys;
+    Vec<Change>              pendingChanges;
+    steady_clock::time_point deadline;
+
+    const fn note = [&](const Change change, const Span<const String> keys) {
+      if (pendingChanges.empty())
+        deadline = steady_clock::now() + m_options.coalesce;
+
+      if (!std::ranges::contains(pendingChanges, change))
+        pendingChanges.push_back(change);
+
+      pendingKeys.insert(keys.begin(), keys.end());
+    };
+
+    const Vec<String> networkKeys = KeysOf(NETWORK_KEYS);
+    const Vec<String> displayKeys = KeysOf(DISPLAY_KEYS);
+
+    while (true) {
+      i32 timeout = -1;
+
+      if (!pendingChanges.empty())
+        timeout = static_cast<i32>(std::max<i64>(0, std::chrono::ceil<std::chrono::milliseconds>(deadline - steady_clock::now()).count()));
+
+      if (::poll(fds.data(), fds.size(), timeout) < 0 && errno != EINTR) {
+        warn_log("ChangeWatcher: poll failed, stopping: {}", std::strerror(errno));
+        return;
+      }
+
+      if (fds[0].revents != 0)
+        return;
+
+      // Any notification at all means the network readouts are out of date; ENOBUFS means we missed some.
+      if (fds[1].revents != 0) {
+        bool changed = false;
+
+        while (true) {
+          const isize received = ::recv(fds[1].fd, buffer.data(), buffer.size(), MSG_DONTWAIT | MSG_TRUNC);
+
+          if (received <= 0 && errno != ENOBUFS)
+            break;
+
+          changed = true;
+        }
+
+        if (changed)
+          note(Change::Network, networkKeys);
+      }
+
+      if (fds[2].revents != 0) {
+        isize received = 0;
+
+        while ((received = ::recv(fds[2].fd, buffer.data(), buffer.size(), MSG_DONTWAIT)) > 0) {
+          const StringView subsystem = UeventSubsystem(StringView(buffer.data(), std::min(static_cast<usize>(received), buffer.size())));
+
+          if (subsystem == "drm")
+            note(Change::Display, displayKeys);
+          else if (subsystem == "power_supply")
+            note(Change::PowerSupply, {});
+        }
+      }
+
+      if (fds[3].revents != 0) {
+        isize received = 0;
+
+        while ((received = ::read(fds[3].fd, buffer.data(), buffer.size())) > 0)
+          for (isize offset = 0; offset < received;) {
+            inotify_event event;
+            std::memcpy(&event, buffer.data() + offset, sizeof(event));
+
+            const StringView name = event.len > 0 ? StringView(buffer.data() + offset + sizeof(event)) : StringView {};
+
+            offset += static_cast<isize>(sizeof(event) + event.len);
+
+            // Events were dropped, so there's no telling which files changed.
+            const bool overflowed = (event.mask & IN_Q_OVERFLOW) != 0;
+
+            for (const Sources::Watch& watch : m_sources->watches)
+              if (overflowed || (watch.descriptor == event.wd && Matches(watch.target, name)))
+                note(watch.target.change, watch.target.keys);
+          }
+      }
+
+      if (pendingChanges.empty() || steady_clock::now() < deadline)
+        continue;
+
+      for (const String& key : pendingKeys)
+        m_cache.invalidate(key);
+
+      if (m_options.onChange)
+        for (const Change change : pendingChanges)
+          m_options.onChange(change);
+
+      pendingKeys.clear();
+      pendingChanges.clear();
+    }
+  }
+} // namespace draconis::services::watcher
+
+#endif // __linux__
@@ -0,0 +1,323 @@
+#ifdef __linux__
+
+  #include <Drac++/Services/CpuSampler.hpp>
+
+  #include <algorithm> // std::{max, min}
+  #include <cerrno>    // errno, EACCES, EINTR
+  #include <cmath>     // std::isnan
+  #include <cstring>   // std::strerror
+  #include <fcntl.h>   // open, O_RDONLY, O_CLOEXEC
+  #include <limits>    // std::numeric_limits
+  #include <unistd.h>  // pread, sysconf, _SC_NPROCESSORS_CONF
+  #include <utility>   // std::{move, swap, to_underlying}
+
+  #include <Drac++/Utils/Error.hpp>
+
+  #include "OS/Linux/SysFs.hpp"
+
+using enum draconis::utils::error::DracErrorCode;
+
+namespace draconis::services::sampling {
+  namespace {
+    using core::system::linux::sysfs::FileDescriptor;
+
+    using utils::types::i64;
+    using utils::types::isize;
+    using utils::types::None;
+    using utils::types::PCStr;
+
+    constexpr PCStr PROC_STAT = "/proc/stat";
+
+    /// Enough for /proc/stat on most machines; the interrupt lines make it grow with the core count.
+    constexpr usize INITIAL_BUFFER_SIZE = 16384;
+
+    /// user, nice, system, idle, iowait, irq, softirq, steal, guest, guest_nice.
+    constexpr usize FIELD_COUNT = 10;
+
+    using Fields = Array<u64, FIELD_COUNT>;
+
+    constexpr f32 OFFLINE = std::numeric_limits<f32>::quiet_NaN();
+
+    /**
+     * @brief Walks /proc/stat text. Only handles what the kernel writes: spaces, newlines and unsigned decimals.
+     */
+    class Scanner {
+     public:
+      explicit Scanner(const StringView text) : m_position(text.data()), m_end(text.data() + text.size()) {}
+
+      fn consume(const StringView prefix) -> bool {
+        if (static_cast<usize>(m_end - m_position) < prefix.size() || StringView(m_position, prefix.size()) != prefix)
+          return false;
+
+        m_position += prefix.size();
+        return true;
+      }
+
+      fn skipSpaces() -> Unit {
+        while (m_position != m_end && *m_position == ' ')
+          ++m_position;
+      }
+
+      fn number() -> Option<u64> {
+        if (m_position == m_end || !IsDigit(*m_position))
+          return None;
+
+        u64 value = 0;
+
+        do
+          value = (value * 10) + static_cast<u64>(*m_position++ - '0');
+        while (m_position != m_end && IsDigit(*m_position));
+
+        return value;
+      }
+
+      /**
+       * @brief Moves past the next newline.
+       * @return False if there is none, i.e. the line was cut off.
+       */
+      fn skipLine() -> bool {
+        while (m_position != m_end)
+          if (*m_position++ == '\n')
+            return true;
+
+        return false;
+      }
+
+     private:
+      static constexpr fn IsDigit(const char character) -> bool {
+        return character >= '0' && character <= '9';
+      }
+
+      const char* m_position;
+      const char* m_end;
+    };
+
+    /**
+     * @brief Calls @p visit with the CPU number (None for the aggregate line) and fields of each cpu line.
+     * @details /proc/stat lists the cpu lines first, so scanning stops at the first other line.
+     * Fields an older kernel doesn't report are zero.
+     */
+    template <typename F>
+    fn ScanCpuLines(const StringView text, F&& visit) -> Unit {
+      Scanner scanner(text);
+
+      while (scanner.consume("cpu")) {
+        const Option<u64> cpu = scanner.number();
+
+        Fields fields {};
+        usize  count = 0;
+
+        for (scanner.skipSpaces(); count < FIELD_COUNT; scanner.skipSpaces()) {
+          const Option<u64> value = scanner.number();
+
+          if (!value)
+            break;
+
+          fields.at(count++) = *value;
+        }
+
+        if (!scanner.skipLine())
+          return;
+
+        // Anything shorter than user/nice/system/idle isn't a line we understand.
+        if (count >= 4)
+          visit(cpu, fields);
+      }
+    }
+
+    /**
+     * @brief The difference between two readings of a counter that's only supposed to grow.
+     * @details Per-CPU iowait can step backwards, and a CPU's counters may restart after it comes back online.
+     */
+    constexpr fn Elapsed(const u64 before, const u64 after) -> u64 {
+      return after > before ? after - before : 0;
+    }
+  } // namespace
+
+  struct CpuSampler::Source {
+    FileDescriptor stat;
+    Vec<char>      buffer;
+  };
+
+  fn CpuSampler::create() -> Result<CpuSampler> {
+    FileDescriptor stat(::open(PROC_STAT, O_RDONLY | O_CLOEXEC));
+
+    if (!stat) {
+      if (errno == EACCES)
+        ERR(PermissionDenied, "Permission denied opening /proc/stat");
+
+      ERR_FMT(ApiUnavailable, "Failed to open /proc/stat: {}", std::strerror(errno));
+    }
+
+    CpuSampler sampler(std::make_unique<Source>(std::move(stat), Vec<char>(INITIAL_BUFFER_SIZE)));
+
+    // A first guess so the usual case never reallocates; record() grows it if more CPUs show up.
+    const i64 configured = ::sysconf(_SC_NPROCESSORS_CONF);
+    sampler.resize(configured > 0 ? static_cast<usize>(configured) : 1);
+
+    return sampler;
+  }
+
+  CpuSampler::CpuSampler(UniquePointer<Source> source) : m_source(std::move(source)) {}
+
+  CpuSampler::~CpuSampler()                                      = default;
+  CpuSampler::CpuSampler(CpuSampler&&) noexcept                  = default;
+  fn CpuSampler::operator=(CpuSampler&&) noexcept -> CpuSampler& = default;
+
+  fn CpuSampler::sample() -> Result<> {
+    Vec<char>& buffer = m_source->buffer;
+
+    while (true) {
+      isize bytesRead = 0;
+
+      do
+        bytesRead = ::pread(m_source->stat.get(), buffer.data(), buffer.size(), 0);
+      while (bytesRead < 0 && errno == EINTR);
+
+      if (bytesRead < 0)
+        ERR_FMT(IoError, "Failed to read /proc/stat: {}", std::strerror(errno));
+
+      if (static_cast<usize>(bytesRead) < buffer.size())
+        return record(StringView(buffer.data(), static_cast<usize>(bytesRead)));
+
+      // Filled the buffer, so there may be more; the kernel regenerates the file on every read anyway.
+      buffer.resize(buffer.size() * 2);
+    }
+  }
+
+  fn CpuSampler::record(const StringView procStat) -> Result<> {
+    for (Ticks& ticks : m_current)
+      ticks.online = false;
+
+    bool  sawAggregate = false;
+    usize columns      = 0;
+
+    ScanCpuLines(procStat, [&](const Option<u64> cpu, const Fields& fields) {
+      const usize column = cpu ? static_cast<usize>(*cpu) + 1 : 0;
+
+      sawAggregate = sawAggregate || !cpu;
+      columns      = std::max(columns, column + 1);
+
+      if (column < m_columns)
+        m_current[column] = {
+          .busy   = fields[0] + fields[1] + fields[2] + fields[5] + fields[6],
+          .idle   = fields[3],
+          .iowait = fields[4],
+          .steal  = fields[7],
+          .online = true,
+        };
+    });
+
+    if (!sawAggregate)
+      ERR(ParseError, "/proc/stat has no aggregate cpu line");
+
+    if (columns > m_columns) {
+      resize(columns - 1);
+      return record(procStat);
+    }
+
+    if (m_hasBaseline) {
+      const usize row = m_next * m_columns;
+
+      for (usize column = 0; column < m_columns; ++column) {
+        const Ticks& before = m_previous[column];
+        const Ticks& after  = m_current[column];
+
+        const u64 busy   = Elapsed(before.busy, after.busy);
+        const u64 idle   = Elapsed(before.idle, after.idle);
+        const u64 iowait = Elapsed(before.iowait, after.iowait);
+        const u64 steal  = Elapsed(before.steal, after.steal);
+        const u64 total  = busy + idle + iowait + steal;
+
+        const bool measured = before.online && after.online && total > 0;
+        const f32  scale    = measured ? 1.0F / static_cast<f32>(total) : 0.0F;
+
+        const fn store = [&](const CpuMetric metric, const u64 ticks) {
+          m_loads.at(std::to_underlying(metric))[row + column] = measured ? static_cast<f32>(ticks) * scale : OFFLINE;
+        };
+
+        store(CpuMetric::Busy, busy);
+        store(CpuMetric::Idle, idle);
+        store(CpuMetric::IoWait, iowait);
+        store(CpuMetric::Steal, steal);
+      }
+
+      m_next  = (m_next + 1) % HISTORY_SIZE;
+      m_count = std::min(m_count + 1, HISTORY_SIZE);
+    }
+
+    std::swap(m_previous, m_current);
+    m_hasBaseline = true;
+
+    return {};
+  }
+
+  fn CpuSampler::resize(const usize cores) -> Unit {
+    m_columns = cores + 1;
+
+    m_previous.assign(m_columns, {});
+    m_current.assign(m_columns, {});
+
+    for (Vec<f32>& metric : m_loads)
+      metric.assign(HISTORY_SIZE * m_columns, OFFLINE);
+
+    m_hasBaseline = false;
+    m_next        = 0;
+    m_count       = 0;
+  }
+
+  fn CpuSampler::coreCount() const -> usize {
+    return m_columns - 1;
+  }
+
+  fn CpuSampler::intervalCount() const -> usize {
+    return m_count;
+  }
+
+  fn CpuSampler::at(const CpuMetric metric, const usize slot, const usize column) const -> f32 {
+    return m_loads.at(std::to_underlying(metric))[(slot * m_columns) + column];
+  }
+
+  fn CpuSampler::load(const usize column, const usize age) const -> Option<CpuLoad> {
+    if (age >= m_count || column >= m_columns)
+      return None;
+
+    const usize slot = (m_next + HISTORY_SIZE - 1 - age) % HISTORY_SIZE;
+    const f32   busy = at(CpuMetric::Busy, slot, column);
+
+    if (std::isnan(busy))
+      return None;
+
+    return CpuLoad {
+      .busy   = busy,
+      .idle   = at(CpuMetric::Idle, slot, column),
+      .iowait = at(CpuMetric::IoWait, slot, column),
+      .steal  = at(CpuMetric::Steal, slot, column),
+    };
+  }
+
+  fn CpuSampler::aggregate(const usize age) const -> Option<CpuLoad> {
+    return load(0, age);
+  }
+
+  fn CpuSampler::core(const usize core, const usize age) const -> Option<CpuLoad> {
+    return load(core + 1, age);
+  }
+
+  fn CpuSampler::series(const CpuMetric metric, const Option<usize> core) const -> Vec<f32> {
+    const usize column = core ? *core + 1 : 0;
+
+    if (column >= m_columns)
+      return {};
+
+    Vec<f32> values;
+    values.reserve(m_count);
+
+    for (usize age = m_count; age-- > 0;)
+      values.push_back(at(metric, (m_next + HISTORY_SIZE - 1 - age) % HISTORY_SIZE, column));
+
+    return values;
+  }
+} // namespace draconis::services::sampling
+
+#endif // __linux__
@@ -0,0 +1,311 @@
+#ifndef _WIN32
+
+  #include <Drac++/Services/LiveMetrics.hpp>
+
+  #include <atomic>  // std::{atomic_ref, atomic_thread_fence, memory_order}
+  #include <cerrno>  // errno, EWOULDBLOCK
+  #include <cstring> // std::{memcpy, strerror}
+
+  #include <fcntl.h>    // O_RDWR, O_RDONLY, O_CREAT, O_CLOEXEC
+  #include <sys/file.h> // flock, LOCK_EX, LOCK_NB
+  #include <sys/mman.h> // shm_open, shm_unlink, mmap, munmap
+  #include <sys/stat.h> // fstat
+  #include <unistd.h>   // close, ftruncate, geteuid
+
+  #include <Drac++/Core/System.hpp>
+
+  #include <Drac++/Utils/Error.hpp>
+
+using enum draconis::utils::error::DracErrorCode;
+
+namespace draconis::services::metrics {
+  namespace {
+    using utils::types::i32;
+    using utils::types::MediaInfo;
+    using utils::types::None;
+    using utils::types::Option;
+    using utils::types::ResourceUsage;
+
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    using std::chrono::seconds;
+    using std::chrono::system_clock;
+
+    constexpr Array<char, 8> SEGMENT_MAGIC  = { 'D', 'R', 'A', 'C', 'L', 'M', '0', '1' };
+    constexpr usize          SNAPSHOT_WORDS = sizeof(Snapshot) / sizeof(u64);
+
+    /// How many times read() retries while the sequence is odd before giving up on the publisher.
+    constexpr usize MAX_READ_ATTEMPTS = 1 << 16;
+
+    /**
+     * @brief Layout of the shared-memory segment.
+     *
+     * `sequence` and `words` are only ever accessed through std::atomic_ref,
+     * so concurrent reads and writes are well-defined; the seqlock is what
+     * makes the copied words a consistent snapshot.
+     */
+    struct Segment {
+      Array<char, 8> magic;
+      u64            snapshotSize; ///< sizeof(Snapshot) in the publishing build; guards against layout changes.
+
+      alignas(64) u64 sequence; ///< Even when the snapshot is stable, odd while it's being written. Zero until the first publish.
+      Array<u64, SNAPSHOT_WORDS> words;
+    };
+
+    static_assert(std::is_trivially_copyable_v<Segment>);
+
+    fn SequenceOf(Segment& segment) -> std::atomic_ref<u64> {
+      return std::atomic_ref<u64>(segment.sequence);
+    }
+
+    // Readers map the segment read-only. Atomic loads don't write, so viewing it as mutable for atomic_ref is fine.
+    fn MutableSegment(const void* segment) -> Segment& {
+      return *static_cast<Segment*>(const_cast<void*>(segment)); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+
+    /**
+     * @brief Whether the shared memory object called @p name is still the one described by @p opened.
+     */
+    fn NameRefersTo(const String& name, const struct stat& opened) -> bool {
+      const i32 fd = shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0);
+
+      if (fd < 0)
+        return false;
+
+      struct stat current {};
+
+      const bool same = fstat(fd, &current) == 0 && current.st_dev == opened.st_dev && current.st_ino == opened.st_ino;
+      close(fd);
+
+      return same;
+    }
+
+    fn CopyText(Array<char, Snapshot::TEXT_SIZE>& out, const StringView text) -> Unit {
+      usize length = std::min(text.size(), out.size() - 1);
+
+      // Don't cut a UTF-8 sequence in half.
+      if (length < text.size())
+        while (length > 0 && (static_cast<u8>(text[length]) & 0xC0U) == 0x80U)
+          --length;
+
+      std::memcpy(out.data(), text.data(), length);
+      out.at(length) = '\0';
+    }
+  } // namespace
+
+  fn Snapshot::battery() const -> Battery {
+    return {
+      static_cast<Battery::Status>(batteryStatus),
+      batteryHasPercentage ? Option<u8>(batteryPercentage) : None,
+      batteryTimeRemaining >= 0 ? Option<seconds>(batteryTimeRemaining) : None,
+    };
+  }
+
+  fn DefaultSegmentName() -> String {
+    return std::format("/draconis++-{}", geteuid());
+  }
+
+  fn CollectSnapshot(CacheManager& cache) -> Snapshot {
+    using namespace core::system;
+
+    Snapshot snapshot;
+
+    snapshot.publishedAtNs = duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+
+    if (Result<ResourceUsage> memInfo = GetMemInfo(cache)) {
+      snapshot.memUsedBytes  = memInfo->usedBytes;
+      snapshot.memTotalBytes = memInfo->totalBytes;
+      snapshot.valid |= Snapshot::MEMORY;
+    } else
+      debug_at(memInfo.error());
+
+    if (Result<seconds> uptime = GetUptime()) {
+      snapshot.uptimeSeconds = uptime->count();
+      snapshot.valid |= Snapshot::UPTIME;
+    } else
+      debug_at(uptime.error());
+
+    if (Result<Battery> battery = GetBatteryInfo(cache)) {
+      snapshot.batteryStatus        = static_cast<u8>(battery->status);
+      snapshot.batteryHasPercentage = battery->percentage.has_value();
+      snapshot.batteryPercentage    = battery->percentage.value_or(0);
+      snapshot.batteryTimeRemaining = battery->timeRemaining ? battery->timeRemaining->count() : -1;
+      snapshot.valid |= Snapshot::BATTERY;
+    } else
+      debug_at(battery.error());
+
+  #if DRAC_ENABLE_NOWPLAYING
+    if (Result<MediaInfo> nowPlaying = GetNowPlaying()) {
+      CopyText(snapshot.title, nowPlaying->title.value_or(""));
+      CopyText(snapshot.artist, nowPlaying->artist.value_or(""));
+      snapshot.valid |= Snapshot::NOW_PLAYING;
+    } else
+      debug_at(nowPlaying.error());
+  #endif
+
+    return snapshot;
+  }
+
+  Publisher::Publisher(String name, const i32 descriptor, void* segment)
+    : m_name(std::move(name)), m_fd(descriptor), m_segment(segment) {}
+
+  Publisher::~Publisher() {
+    munmap(m_segment, sizeof(Segment));
+
+    // Unlink before closing, which releases the lock, so the next publisher can't lock the old segment and keep it.
+    shm_unlink(m_name.c_str());
+    close(m_fd);
+  }
+
+  fn Publisher::create(const StringView name) -> Result<UniquePointer<Publisher>> {
+    const String segmentName(name);
+
+    const i32 fd = shm_open(segmentName.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+
+    if (fd < 0)
+      ERR_FMT(errno == EACCES ? PermissionDenied : IoError, "Failed to open shared memory segment {}: {}", segmentName, std::strerror(errno));
+
+    struct stat info {};
+
+    // Readers trust whatever is in the segment, so don't publish into one someone else created.
+    if (fstat(fd, &info) != 0 || info.st_uid != geteuid()) {
+      close(fd);
+      ERR_FMT(PermissionDenied, "Shared memory segment {} is not owned by the current user", segmentName);
+    }
+
+    // Without this, a second publisher would reset the sequence under a live one and unlink its segment on exit.
+    // Some systems (macOS) can't lock shared memory objects at all; there it's up to the caller to run only one.
+    if (flock(fd, LOCK_EX | LOCK_NB) != 0) {
+      if (errno == EWOULDBLOCK) {
+        close(fd);
+        ERR_FMT(ConfigurationError, "Shared memory segment {} is already in use by another publisher", segmentName);
+      }
+
+      debug_log("Can't lock shared memory segment {}: {}", segmentName, std::strerror(errno));
+    }
+
+    // A publisher that was shutting down may have unlinked the name between our open and our lock,
+    // leaving us with a segment no reader can find; start over on the new one.
+    if (!NameRefersTo(segmentName, info)) {
+      close(fd);
+      return create(name);
+    }
+
+    if (ftruncate(fd, sizeof(Segment)) != 0) {
+      const i32 err = errno;
+      close(fd);
+      ERR_FMT(IoError, "Failed to size shared memory segment {}: {}", segmentName, std::strerror(err));
+    }
+
+    void* mapping = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    if (mapping == MAP_FAILED) {
+      const i32 err = errno;
+      close(fd);
+      ERR_FMT(IoError, "Failed to map shared memory segment {}: {}", segmentName, std::strerror(err));
+    }
+
+    auto& segment = *static_cast<Segment*>(mapping);
+
+    // Readers check the header once when they open, so write it before anything is published.
+    SequenceOf(segment).store(0, std::memory_order_relaxed);
+    segment.magic        = SEGMENT_MAGIC;
+    segment.snapshotSize = sizeof(Snapshot);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return UniquePointer<Publisher>(new Publisher(segmentName, fd, mapping));
+  }
+
+  fn Publisher::publish(const Snapshot& snapshot) -> Unit {
+    auto& segment = *static_cast<Segment*>(m_segment);
+
+    Array<u64, SNAPSHOT_WORDS> words;
+    std::memcpy(words.data(), &snapshot, sizeof(Snapshot));
+
+    std::atomic_ref<u64> sequence = SequenceOf(segment);
+    const u64            current  = sequence.load(std::memory_order_relaxed);
+
+    sequence.store(current + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (usize i = 0; i < SNAPSHOT_WORDS; ++i)
+      std::atomic_ref<u64>(segment.words.at(i)).store(words.at(i), std::memory_order_relaxed);
+
+    sequence.store(current + 2, std::memory_order_release);
+  }
+
+  Reader::Reader(const void* segment) : m_segment(segment) {}
+
+  Reader::~Reader() {
+    munmap(const_cast<void*>(m_segment), sizeof(Segment)); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+  }
+
+  fn Reader::open(const StringView name) -> Result<UniquePointer<Reader>> {
+    const String segmentName(name);
+
+    const i32 fd = shm_open(segmentName.c_str(), O_RDONLY | O_CLOEXEC, 0);
+
+    if (fd < 0) {
+      if (errno == ENOENT)
+        ERR_FMT(NotFound, "No live metrics are being published at {}", segmentName);
+
+      ERR_FMT(errno == EACCES ? PermissionDenied : IoError, "Failed to open shared memory segment {}: {}", segmentName, std::strerror(errno));
+    }
+
+    struct stat info {};
+
+    if (fstat(fd, &info) != 0 || static_cast<usize>(info.st_size) < sizeof(Segment)) {
+      close(fd);
+      ERR_FMT(CorruptedData, "Shared memory segment {} is too small", segmentName);
+    }
+
+    void* mapping = mmap(nullptr, sizeof(Segment), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+      ERR_FMT(IoError, "Failed to map shared memory segment {}: {}", segmentName, std::strerror(errno));
+
+    const auto& segment = *static_cast<const Segment*>(mapping);
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (segment.magic != SEGMENT_MAGIC || segment.snapshotSize != sizeof(Snapshot)) {
+      munmap(mapping, sizeof(Segment));
+      ERR_FMT(CorruptedData, "Shared memory segment {} has an unexpected layout", segmentName);
+    }
+
+    return UniquePointer<Reader>(new Reader(mapping));
+  }
+
+  fn Reader::read() const -> Result<Snapshot> {
+    Segment&             segment  = MutableSegment(m_segment);
+    std::atomic_ref<u64> sequence = SequenceOf(segment);
+
+    Array<u64, SNAPSHOT_WORDS> words;
+
+    for (usize attempt = 0; attempt < MAX_READ_ATTEMPTS; ++attempt) {
+      const u64 before = sequence.load(std::memory_order_acquire);
+
+      if (before == 0)
+        ERR(NotFound, "No snapshot has been published yet");
+
+      if (before % 2 != 0)
+        continue;
+
+      for (usize i = 0; i < SNAPSHOT_WORDS; ++i)
+        words.at(i) = std::atomic_ref<u64>(segment.words.at(i)).load(std::memory_order_relaxed);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+      if (sequence.load(std::memory_order_relaxed) == before) {
+        Snapshot snapshot;
+        std::memcpy(&snapshot, words.data(), sizeof(Snapshot));
+        return snapshot;
+      }
+    }
+
+    ERR(Timeout, "Snapshot stayed mid-write; the publisher may have died while publishing");
+  }
+} // namespace draconis::services::metrics
+
+#endif // !_WIN32
@@ -0,0 +1,201 @@
+#ifdef __linux__
+
+  #include <Drac++/Services/NetworkSampler.hpp>
+
+  #include <algorithm>         // std::min
+  #include <linux/rtnetlink.h> // RTM_GETLINK
+  #include <sys/socket.h>      // AF_UNSPEC
+
+  #include <Drac++/Utils/Error.hpp>
+
+  #include "OS/Linux/Netlink.hpp"
+  #include "OS/Linux/SysFs.hpp"
+
+using enum draconis::utils::error::DracErrorCode;
+
+namespace draconis::services::sampling {
+  namespace {
+    namespace netlink = core::system::linux::netlink;
+    namespace sysfs   = core::system::linux::sysfs;
+
+    using utils::types::Err;
+    using utils::types::None;
+    using utils::types::Pair;
+
+    using std::chrono::duration;
+    using std::chrono::milliseconds;
+
+    /**
+     * @brief Reads an interface's counters from its sysfs statistics directory.
+     */
+    fn ReadStatistics(const sysfs::Directory& classNet, const StringView name) -> Result<InterfaceCounters> {
+      // Entry names from getdents are NUL-terminated, so data() can be passed on as-is.
+      Result<sysfs::Directory> interface = classNet.open(name.data());
+
+      if (!interface)
+        return Err(std::move(interface).error());
+
+      Result<sysfs::Directory> statistics = interface->open("statistics");
+
+      if (!statistics)
+        return Err(std::move(statistics).error());
+
+      InterfaceCounters counters;
+
+      for (auto [file, counter] : { Pair { "rx_bytes", &counters.rxBytes }, Pair { "tx_bytes", &counters.txBytes }, Pair { "rx_packets", &counters.rxPackets }, Pair { "tx_packets", &counters.txPackets } }) {
+        Result<u64> value = statistics->readInt<u64>(file);
+
+        if (!value)
+          return Err(std::move(value).error());
+
+        *counter = *value;
+      }
+
+      return counters;
+    }
+  } // namespace
+
+  struct NetworkSampler::Source {
+    Option<netlink::Socket> socket;
+    netlink::ReceiveBuffer  buffer;
+    sysfs::Directory        classNet { "/sys/class/net" };
+  };
+
+  fn NetworkSampler::create() -> Result<NetworkSampler> {
+    auto source = std::make_unique<Source>();
+
+    if (Result<netlink::Socket> socket = netlink::Socket::open())
+      source->socket = std::move(*socket);
+    else if (!source->classNet)
+      ERR_FMT(ApiUnavailable, "Neither netlink nor /sys/class/net is available: {}", socket.error().message);
+
+    return NetworkSampler(std::move(source));
+  }
+
+  NetworkSampler::NetworkSampler(UniquePointer<Source> source) : m_source(std::move(source)) {}
+
+  NetworkSampler::~NetworkSampler()                                          = default;
+  NetworkSampler::NetworkSampler(NetworkSampler&&) noexcept                  = default;
+  fn NetworkSampler::operator=(NetworkSampler&&) noexcept -> NetworkSampler& = default;
+
+  fn NetworkSampler::sample() -> Result<> {
+    const steady_clock::time_point now = steady_clock::now();
+
+    ++m_generation;
+
+    if (m_source->socket) {
+      Result<> done = m_source->socket->dump(RTM_GETLINK, AF_UNSPEC, m_source->buffer, [this, now](const netlink::Message& message) {
+        const Option<netlink::Link> link = netlink::ParseLink(message);
+
+        // Links without IFLA_STATS64 have nothing to sample.
+        if (!link || !link->rxBytes || !link->txBytes || !link->rxPackets || !link->txPackets)
+          return;
+
+        record(link->name, { .rxBytes = *link->rxBytes, .txBytes = *link->txBytes, .rxPackets = *link->rxPackets, .txPackets = *link->txPackets }, now);
+      });
+
+      if (!done)
+        return done;
+    } else {
+      Result<bool> listed = m_source->classNet.forEachEntry([this, now](const StringView name) {
+        // An interface can vanish between listing and reading; it'll simply be missing from this sample.
+        if (Result<InterfaceCounters> counters = ReadStatistics(m_source->classNet, name))
+          record(name, *counters, now);
+
+        return false;
+      });
+
+      if (!listed)
+        return Err(std::move(listed).error());
+    }
+
+    std::erase_if(m_histories, [this](const auto& entry) { return entry.second.generation != m_generation; });
+
+    return {};
+  }
+
+  fn NetworkSampler::record(const StringView name, const InterfaceCounters& counters, const steady_clock::time_point at) -> Unit {
+    auto iter = m_histories.find(name);
+
+    if (iter == m_histories.end())
+      iter = m_histories.emplace(String(name), History {}).first;
+
+    History& history   = iter->second;
+    history.generation = m_generation;
+
+    if (history.count > 0) {
+      const InterfaceCounters& previous = history.latest().counters;
+
+      // Counters only go down when the interface was recreated (or a driver reset them), so the old samples are meaningless.
+      if (counters.rxBytes < previous.rxBytes || counters.txBytes < previous.txBytes || counters.rxPackets < previous.rxPackets || counters.txPackets < previous.txPackets)
+        history.count = 0;
+    }
+
+    history.samples.at(history.next) = { .at = at, .counters = counters };
+    history.next                     = (history.next + 1) % HISTORY_SIZE;
+    history.count                    = std::min(history.count + 1, HISTORY_SIZE);
+  }
+
+  fn NetworkSampler::History::latest() const -> const Sample& {
+    return samples.at((next + HISTORY_SIZE - 1) % HISTORY_SIZE);
+  }
+
+  fn NetworkSampler::History::rates(const milliseconds window) const -> Option<ThroughputRates> {
+    if (count < 2)
+      return None;
+
+    const Sample& newest = latest();
+
+    // The oldest sample still inside the window, but always at least the one before the newest, so
+    // sampling less often than the window still gives a rate.
+    const Sample* oldest = &samples.at((next + HISTORY_SIZE - 2) % HISTORY_SIZE);
+
+    for (usize age = 2; age < count; ++age) {
+      const Sample& candidate = samples.at((next + HISTORY_SIZE - 1 - age) % HISTORY_SIZE);
+
+      if (newest.at - candidate.at > window)
+        break;
+
+      oldest = &candidate;
+    }
+
+    const f64 seconds = duration<f64>(newest.at - oldest->at).count();
+
+    if (seconds <= 0)
+      return None;
+
+    const fn rate = [seconds](const u64 from, const u64 to) { return static_cast<f64>(to - from) / seconds; };
+
+    return ThroughputRates {
+      .rxBytes   = rate(oldest->counters.rxBytes, newest.counters.rxBytes),
+      .txBytes   = rate(oldest->counters.txBytes, newest.counters.txBytes),
+      .rxPackets = rate(oldest->counters.rxPackets, newest.counters.rxPackets),
+      .txPackets = rate(oldest->counters.txPackets, newest.counters.txPackets),
+    };
+  }
+
+  fn NetworkSampler::describe(const String& name, const History& history, const milliseconds window) -> InterfaceThroughput {
+    return { .name = name, .totals = history.latest().counters, .perSecond = history.rates(window) };
+  }
+
+  fn NetworkSampler::throughput(const StringView name, const milliseconds window) const -> Result<InterfaceThroughput> {
+    const auto iter = m_histories.find(name);
+
+    if (iter == m_histories.end())
+      ERR_FMT(NotFound, "Interface '{}' hasn't been sampled", name);
+
+    return describe(iter->first, iter->second, window);
+  }
+
+  fn NetworkSampler::throughput(const milliseconds window) const -> Vec<InterfaceThroughput> {
+    Vec<InterfaceThroughput> interfaces;
+    interfaces.reserve(m_histories.size());
+
+    for (const auto& [name, history] : m_histories)
+      interfaces.push_back(describe(name, history, window));
+
+    return interfaces;
+  }
+} // namespace draconis::services::sampling
+
+#endif // __linux__
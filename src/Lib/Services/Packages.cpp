@@ -6,16 +6,21 @@
     #include <SQLiteCpp/Database.h>  // SQLite::{Database, OPEN_READONLY}
     #include <SQLiteCpp/Exception.h> // SQLite::Exception
     #include <SQLiteCpp/Statement.h> // SQLite::Statement
+    #include <sqlite3.h>               // sqlite3_progress_handler
   #endif
 
   #if defined(__linux__) && defined(HAVE_PUGIXML)
     #include <pugixml.hpp> // pugi::{xml_document, xml_node, xml_parse_result}
   #endif
 
+  #include <algorithm>    // std::min
+  #include <chrono>       // std::chrono::{days, milliseconds}
   #include <filesystem>   // std::filesystem
+  #include <limits>       // std::numeric_limits
   #include <matchit.hpp>  // matchit::{match, is, or_, _}
   #include <system_error> // std::{errc, error_code}
 
+  #include "Drac++/Utils/Cancellation.hpp"
   #include "Drac++/Utils/Env.hpp"
   #include "Drac++/Utils/Error.hpp"
   #include "Drac++/Utils/Logging.hpp"
@@ -24,18 +29,39 @@
 namespace fs = std::filesystem;
 
 using namespace draconis::utils::types;
-using draconis::utils::cache::CacheManager;
+using draconis::utils::cache::CacheManager, draconis::utils::cache::CachePolicy, draconis::utils::cache::CacheValidator;
+using draconis::utils::cancellation::CheckCancelled, draconis::utils::cancellation::RemainingTime, draconis::utils::cancellation::StopRequested;
 using enum draconis::utils::error::DracErrorCode;
 
 namespace {
   constexpr const char* CACHE_KEY_PREFIX = "pkg_count_";
 
+  // How many directory entries to count between cancellation checks.
+  constexpr u64 CANCELLATION_CHECK_INTERVAL = 256;
+
+  // How many SQLite VM instructions to run between cancellation checks.
+  constexpr i32 SQLITE_PROGRESS_INTERVAL = 10000;
+
+  // Counts are re-validated against their source files, so they don't need a
+  // TTL. The same goes for "not installed", which is by far the common result
+  // when probing every supported manager; the negative TTL is only a backstop.
+  // Where they're kept is still up to the global policy.
+  fn CountPolicy(const CacheManager& cache) -> CachePolicy {
+    CachePolicy policy = cache.getGlobalPolicy();
+    policy.ttl         = None;
+    policy.negativeTtl = std::chrono::days(1);
+    return policy;
+  }
+
   fn GetCountFromDirectoryImplNoCache(
     const String&         pmId,
     const fs::path&       dirPath,
     const Option<String>& fileExtensionFilter,
     const bool            subtractOne
   ) -> Result<u64> {
+    if (Result live = CheckCancelled(); !live)
+      return Err(live.error());
+
     std::error_code fsErrCode;
 
     fsErrCode.clear();
@@ -63,8 +89,15 @@ namespace {
       if (fsErrCode)
         ERR_FMT(ResourceExhausted, "Failed to create iterator for {} directory '{}': {} (resource exhausted or API unavailable)", pmId, dirPath.string(), fsErrCode.message());
 
+      // Large directories on slow or network filesystems can take a while, so give up part-way if asked to.
+      u64 visited = 0;
+
       if (hasFilter) {
         for (const fs::directory_entry& entry : dirIter) {
+          if (++visited % CANCELLATION_CHECK_INTERVAL == 0)
+            if (Result live = CheckCancelled(); !live)
+              return Err(live.error());
+
           if (entry.path().empty())
             continue;
 
@@ -76,6 +109,10 @@ namespace {
         }
       } else {
         for (const fs::directory_entry& entry : dirIter) {
+          if (++visited % CANCELLATION_CHECK_INTERVAL == 0)
+            if (Result live = CheckCancelled(); !live)
+              return Err(live.error());
+
           if (!entry.path().empty())
             count++;
         }
@@ -101,7 +138,11 @@ namespace {
     const Option<String>& fileExtensionFilter,
     const bool            subtractOne
   ) -> Result<u64> {
-    return cache.getOrSet<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), [&]() -> Result<u64> {
+    // Fetchers capture by value throughout this file: the cache may re-run them in the background.
+    // Installing or removing a package adds or removes a directory entry, which bumps the directory's mtime.
+    const CacheValidator validator { .sources = { dirPath } };
+
+    return cache.getOrSet<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), CountPolicy(cache), validator, [pmId, dirPath, fileExtensionFilter, subtractOne]() -> Result<u64> {
       return GetCountFromDirectoryImplNoCache(pmId, dirPath, fileExtensionFilter, subtractOne);
     });
   }
@@ -147,14 +188,27 @@ namespace draconis::services::packages {
     const fs::path& dbPath,
     const String&   countQuery
   ) -> Result<u64> {
-    return cache.getOrSet<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), [&]() -> Result<u64> {
+    // In WAL mode recent transactions may only have touched the -wal file, not the database itself.
+    const CacheValidator validator { .sources = { dbPath, fs::path(dbPath).concat("-wal") } };
+
+    return cache.getOrSet<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), CountPolicy(cache), validator, [pmId, dbPath, countQuery]() -> Result<u64> {
       u64 count = 0;
 
       try {
         if (std::error_code existsErr; !fs::exists(dbPath, existsErr) || existsErr)
           ERR_FMT(NotFound, "{} database not found at '{}' (file does not exist or access denied)", pmId, dbPath.string());
 
-        const SQLite::Database database(dbPath.string(), SQLite::OPEN_READONLY);
+        if (Result live = CheckCancelled(); !live)
+          return Err(live.error());
+
+        SQLite::Database database(dbPath.string(), SQLite::OPEN_READONLY);
+
+        // Interrupts the query once the caller is cancelled or out of time, and
+        // waits on a locked database only as long as the deadline allows.
+        sqlite3_progress_handler(database.getHandle(), SQLITE_PROGRESS_INTERVAL, [](RawPointer) -> i32 { return StopRequested() ? 1 : 0; }, nullptr);
+
+        if (const Option<std::chrono::milliseconds> remaining = RemainingTime())
+          database.setBusyTimeout(static_cast<i32>(std::min<i64>(remaining->count(), std::numeric_limits<i32>::max())));
 
         if (SQLite::Statement queryStmt(database, countQuery); queryStmt.executeStep()) {
           const i64 countInt64 = queryStmt.getColumn(0).getInt64();
@@ -166,6 +220,10 @@ namespace draconis::services::packages {
         } else
           ERR_FMT(ParseError, "No rows returned by {} DB COUNT query (empty result set)", pmId);
       } catch (const SQLite::Exception& e) {
+        // An interrupted query must not be reported as ApiUnavailable, or it would be remembered as a negative result.
+        if (Result live = CheckCancelled(); !live)
+          return Err(live.error());
+
         ERR_FMT(ApiUnavailable, "SQLite error occurred accessing {} database '{}': {}", pmId, dbPath.string(), e.what());
       } catch (const Exception& e) {
         ERR_FMT(InternalError, "Standard exception accessing {} database '{}': {}", pmId, dbPath.string(), e.what());
@@ -184,7 +242,9 @@ namespace draconis::services::packages {
     const String&   pmId,
     const fs::path& plistPath
   ) -> Result<u64> {
-    return cache.getOrSet<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), [&]() -> Result<u64> {
+    const CacheValidator validator { .sources = { plistPath } };
+
+    return cache.getOrSet<u64>(std::format("{}{}", CACHE_KEY_PREFIX, pmId), CountPolicy(cache), validator, [plistPath]() -> Result<u64> {
       xml_document doc;
 
       if (const xml_parse_result result = doc.load_file(plistPath.c_str()); !result)
@@ -267,8 +327,8 @@ namespace draconis::services::packages {
         oneSucceeded = true;
       } else {
         match(result.error().code)(
-          is | or_(NotFound, ApiUnavailable, NotSupported) = [&] -> Unit { debug_at(result.error()); },
-          is | _                                           = [&] -> Unit { error_at(result.error()); }
+          is | or_(NotFound, ApiUnavailable, NotSupported, Cancelled, Timeout) = [&] -> Unit { debug_at(result.error()); },
+          is | _                                                               = [&] -> Unit { error_at(result.error()); }
         );
       }
     };
@@ -322,6 +382,10 @@ namespace draconis::services::packages {
     if (HasPackageManager(enabledPackageManagers, Manager::Cargo))
       processResult(CountCargo(cache));
 
+    // A total that is missing the managers we didn't get to would look plausible but be wrong.
+    if (Result live = CheckCancelled(); !live)
+      return Err(live.error());
+
     if (!oneSucceeded && totalCount == 0)
       ERR(UnavailableFeature, "No package managers found or none reported counts (feature not available)");
 
@@ -340,8 +404,8 @@ namespace draconis::services::packages {
         oneSucceeded           = true;
       } else {
         match(result.error().code)(
-          is | or_(NotFound, ApiUnavailable, NotSupported) = [&] -> Unit { debug_at(result.error()); },
-          is | _                                           = [&] -> Unit { error_at(result.error()); }
+          is | or_(NotFound, ApiUnavailable, NotSupported, Cancelled, Timeout) = [&] -> Unit { debug_at(result.error()); },
+          is | _                                                               = [&] -> Unit { error_at(result.error()); }
         );
       }
     };
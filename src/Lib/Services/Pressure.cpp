@@ -0,0 +1,379 @@
+#ifdef __linux__
+
+  #include <Drac++/Services/Pressure.hpp>
+
+  #include <algorithm>     // std::{max, min}
+  #include <cerrno>        // errno, EACCES, EINTR, EINVAL, ENOENT, EOPNOTSUPP, EPERM
+  #include <charconv>      // std::from_chars
+  #include <cstring>       // std::strerror
+  #include <fcntl.h>       // open, O_RDWR, O_NONBLOCK, O_CLOEXEC
+  #include <format>        // std::format
+  #include <limits>        // std::numeric_limits
+  #include <sys/epoll.h>   // epoll_create1, epoll_ctl, epoll_wait, epoll_event, EPOLL*
+  #include <sys/eventfd.h> // eventfd, EFD_CLOEXEC, EFD_NONBLOCK
+  #include <unistd.h>      // read, write
+
+  #include <Drac++/Utils/Cancellation.hpp>
+  #include <Drac++/Utils/Error.hpp>
+
+  #include "OS/Linux/SysFs.hpp"
+
+using enum draconis::utils::error::DracErrorCode;
+
+namespace draconis::services::pressure {
+  namespace {
+    using core::system::linux::sysfs::Directory;
+    using core::system::linux::sysfs::FileBuffer;
+    using core::system::linux::sysfs::FileDescriptor;
+    using core::system::linux::sysfs::ParseInt;
+    using core::system::linux::sysfs::TrimEnd;
+
+    using utils::cancellation::CancellationScope;
+    using utils::cancellation::CheckCancelled;
+    using utils::cancellation::ClampTimeout;
+    using utils::error::DracError;
+
+    using utils::types::Array;
+    using utils::types::Err;
+    using utils::types::i32;
+    using utils::types::Map;
+    using utils::types::None;
+    using utils::types::Span;
+    using utils::types::String;
+    using utils::types::usize;
+
+    using std::chrono::steady_clock;
+
+    /// Epoll data of the eventfd wake() writes to; trigger ids count up from zero and never reach it.
+    constexpr TriggerId WAKE_ID = std::numeric_limits<TriggerId>::max();
+
+    constexpr usize MAX_EVENTS = 16;
+
+    constexpr microseconds MIN_WINDOW = milliseconds(500);
+    constexpr microseconds MAX_WINDOW = std::chrono::seconds(10);
+
+    constexpr fn NameOf(const Resource resource) -> StringView {
+      switch (resource) {
+        case Resource::Cpu:    return "cpu";
+        case Resource::Memory: return "memory";
+        case Resource::Io:     return "io";
+      }
+
+      return "unknown";
+    }
+
+    fn ParseDouble(const StringView text) -> Option<f64> {
+      f64 value = 0;
+
+      auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+      if (ec == std::errc() && ptr == text.data() + text.size())
+        return value;
+
+      return None;
+    }
+
+    /**
+     * @brief Parses "avg10=0.52 avg60=0.91 avg300=0.78 total=40416976", the part of a line after "some" or "full".
+     */
+    fn ParseStallTime(StringView fields) -> Option<StallTime> {
+      StallTime stall;
+      usize     seen = 0;
+
+      while (!fields.empty()) {
+        const usize      end   = fields.find(' ');
+        const StringView field = fields.substr(0, end);
+
+        fields.remove_prefix(end == StringView::npos ? fields.size() : end + 1);
+
+        const usize equals = field.find('=');
+
+        if (equals == StringView::npos)
+          continue;
+
+        const StringView key   = field.substr(0, equals);
+        const StringView value = field.substr(equals + 1);
+
+        if (key == "total") {
+          const Option<u64> total = ParseInt<u64>(value);
+
+          if (!total)
+            return None;
+
+          stall.total = microseconds(*total);
+          ++seen;
+          continue;
+        }
+
+        f64* average = key == "avg10" ? &stall.avg10 : key == "avg60" ? &stall.avg60 : key == "avg300" ? &stall.avg300 : nullptr;
+
+        if (!average)
+          continue;
+
+        const Option<f64> parsed = ParseDouble(value);
+
+        if (!parsed)
+          return None;
+
+        *average = *parsed;
+        ++seen;
+      }
+
+      // Each of avg10, avg60, avg300 and total.
+      if (seen != 4)
+        return None;
+
+      return stall;
+    }
+
+    fn PsiUnavailable(const StringView where) -> Err<DracError> {
+      return Err(DracError(UnavailableFeature, std::format("No pressure information in {}; the kernel needs CONFIG_PSI and must not be booted with psi=0", where)));
+    }
+
+    fn ReadPressureFile(const Directory& directory, const StringView where, const String& file) -> Result<Pressure> {
+      FileBuffer buffer;
+
+      Result<StringView> contents = directory.read(file.c_str(), buffer);
+
+      if (!contents) {
+        if (contents.error().code == NotFound)
+          return PsiUnavailable(where);
+
+        return Err(std::move(contents).error());
+      }
+
+      return ParsePressure(*contents);
+    }
+  } // namespace
+
+  fn ParsePressure(StringView contents) -> Result<Pressure> {
+    Option<StallTime> some;
+    Option<StallTime> full;
+
+    while (!contents.empty()) {
+      const usize      end  = contents.find('\n');
+      const StringView line = TrimEnd(contents.substr(0, end));
+
+      contents.remove_prefix(end == StringView::npos ? contents.size() : end + 1);
+
+      if (line.starts_with("some "))
+        some = ParseStallTime(line.substr(5));
+      else if (line.starts_with("full "))
+        full = ParseStallTime(line.substr(5));
+    }
+
+    if (!some)
+      ERR(ParseError, "Pressure file has no valid 'some' line");
+
+    return Pressure { .some = *some, .full = full };
+  }
+
+  fn GetPressure(const Resource resource) -> Result<Pressure> {
+    static const Directory PROC_PRESSURE("/proc/pressure");
+
+    if (!PROC_PRESSURE)
+      return PsiUnavailable("/proc/pressure");
+
+    return ReadPressureFile(PROC_PRESSURE, "/proc/pressure", String(NameOf(resource)));
+  }
+
+  fn GetCgroupPressure(const Resource resource, const fs::path& cgroup) -> Result<Pressure> {
+    const String    path = cgroup.string();
+    const Directory directory(path.c_str());
+
+    if (!directory)
+      ERR_FMT(NotFound, "Cgroup directory '{}' not found", path);
+
+    return ReadPressureFile(directory, path, std::format("{}.pressure", NameOf(resource)));
+  }
+
+  fn GetCurrentCgroup() -> Result<fs::path> {
+    // Pure cgroup v2 mounts the hierarchy here; hybrid setups mount it one level down.
+    constexpr Array<StringView, 2> ROOTS = { "/sys/fs/cgroup", "/sys/fs/cgroup/unified" };
+
+    Option<fs::path> root;
+
+    for (const StringView candidate : ROOTS)
+      if (std::error_code error; fs::exists(fs::path(candidate) / "cgroup.controllers", error)) {
+        root = fs::path(candidate);
+        break;
+      }
+
+    if (!root)
+      ERR(NotSupported, "No cgroup v2 hierarchy is mounted");
+
+    // The unified hierarchy's line is "0::<path>"; v1 controllers have their own numbered lines.
+    Option<String> relative;
+
+    const Directory self("/proc/self");
+
+    Result<> scanned = self.forEachLine("cgroup", [&relative](const StringView line) {
+      if (!line.starts_with("0::"))
+        return false;
+
+      relative = String(line.substr(3));
+      return true;
+    });
+
+    if (!scanned)
+      return Err(std::move(scanned).error());
+
+    if (!relative)
+      ERR(NotFound, "This process isn't in a cgroup v2 cgroup");
+
+    return *root / fs::path(*relative).relative_path();
+  }
+
+  struct PressureMonitor::State {
+    FileDescriptor                 epoll;
+    FileDescriptor                 wakeup;
+    Map<TriggerId, FileDescriptor> triggers;
+    TriggerId                      nextId = 0;
+  };
+
+  fn PressureMonitor::create() -> Result<PressureMonitor> {
+    FileDescriptor epoll(::epoll_create1(EPOLL_CLOEXEC));
+
+    if (!epoll)
+      ERR_FMT(ResourceExhausted, "Failed to create an epoll instance: {}", std::strerror(errno));
+
+    FileDescriptor wakeup(::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK));
+
+    if (!wakeup)
+      ERR_FMT(ResourceExhausted, "Failed to create an eventfd: {}", std::strerror(errno));
+
+    epoll_event event { .events = EPOLLIN, .data = { .u64 = WAKE_ID } };
+
+    if (::epoll_ctl(epoll.get(), EPOLL_CTL_ADD, wakeup.get(), &event) != 0)
+      ERR_FMT(IoError, "Failed to watch the wake eventfd: {}", std::strerror(errno));
+
+    return PressureMonitor(std::make_unique<State>(std::move(epoll), std::move(wakeup), Map<TriggerId, FileDescriptor> {}, 0));
+  }
+
+  PressureMonitor::PressureMonitor(UniquePointer<State> state) : m_state(std::move(state)) {}
+
+  PressureMonitor::~PressureMonitor()                                          = default;
+  PressureMonitor::PressureMonitor(PressureMonitor&&) noexcept                 = default;
+  fn PressureMonitor::operator=(PressureMonitor&&) noexcept -> PressureMonitor& = default;
+
+  fn PressureMonitor::subscribe(const Trigger& trigger) -> Result<TriggerId> {
+    if (trigger.window < MIN_WINDOW || trigger.window > MAX_WINDOW)
+      ERR_FMT(InvalidArgument, "PSI trigger window must be between 500ms and 10s, not {}us", trigger.window.count());
+
+    if (trigger.threshold <= microseconds::zero() || trigger.threshold > trigger.window)
+      ERR_FMT(InvalidArgument, "PSI trigger threshold must be positive and at most the window, not {}us", trigger.threshold.count());
+
+    const String file = trigger.cgroup ? (*trigger.cgroup / std::format("{}.pressure", NameOf(trigger.resource))).string()
+                                       : std::format("/proc/pressure/{}", NameOf(trigger.resource));
+
+    FileDescriptor descriptor(::open(file.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC));
+
+    if (!descriptor) {
+      if (errno == EACCES || errno == EPERM)
+        ERR_FMT(PermissionDenied, "Permission denied opening {} for writing", file);
+
+      if (errno == ENOENT && trigger.cgroup && !fs::is_directory(*trigger.cgroup))
+        ERR_FMT(NotFound, "Cgroup directory '{}' not found", trigger.cgroup->string());
+
+      if (errno == ENOENT || errno == EOPNOTSUPP)
+        return PsiUnavailable(file);
+
+      ERR_FMT(IoError, "Failed to open {}: {}", file, std::strerror(errno));
+    }
+
+    // The kernel reads "<some|full> <threshold us> <window us>", NUL-terminated.
+    const String request = std::format("{} {} {}", trigger.stall == Stall::Full ? "full" : "some", trigger.threshold.count(), trigger.window.count());
+
+    if (::write(descriptor.get(), request.c_str(), request.size() + 1) < 0) {
+      if (errno == EINVAL)
+        ERR_FMT(InvalidArgument, "Kernel rejected PSI trigger '{}' on {}; unprivileged processes need a window that's a multiple of 2s", request, file);
+
+      if (errno == EACCES || errno == EPERM)
+        ERR_FMT(PermissionDenied, "Not allowed to create PSI triggers on {}", file);
+
+      if (errno == EOPNOTSUPP)
+        return PsiUnavailable(file);
+
+      ERR_FMT(IoError, "Failed to register PSI trigger on {}: {}", file, std::strerror(errno));
+    }
+
+    const TriggerId id = m_state->nextId++;
+
+    epoll_event event { .events = EPOLLPRI, .data = { .u64 = id } };
+
+    if (::epoll_ctl(m_state->epoll.get(), EPOLL_CTL_ADD, descriptor.get(), &event) != 0)
+      ERR_FMT(IoError, "Failed to watch PSI trigger on {}: {}", file, std::strerror(errno));
+
+    m_state->triggers.emplace(id, std::move(descriptor));
+
+    return id;
+  }
+
+  fn PressureMonitor::unsubscribe(const TriggerId trigger) -> Result<> {
+    // Closing the descriptor removes the trigger in the kernel and drops it from the epoll set.
+    if (m_state->triggers.erase(trigger) == 0)
+      ERR_FMT(NotFound, "PSI trigger {} isn't subscribed", trigger);
+
+    return {};
+  }
+
+  fn PressureMonitor::wait(const Option<milliseconds> timeout) -> Result<Vec<TriggerEvent>> {
+    const bool                             scoped   = CancellationScope::current() != nullptr;
+    const Option<steady_clock::time_point> deadline = timeout.transform([](const milliseconds duration) { return steady_clock::now() + duration; });
+
+    Array<epoll_event, MAX_EVENTS> events {};
+    Vec<TriggerEvent>              fired;
+
+    while (true) {
+      if (Result<> live = CheckCancelled(); !live)
+        return Err(std::move(live).error());
+
+      // -1 blocks indefinitely; a scope caps each slice so its token and deadline are noticed.
+      milliseconds slice = milliseconds(-1);
+
+      if (deadline)
+        slice = std::max(std::chrono::ceil<milliseconds>(*deadline - steady_clock::now()), milliseconds(0));
+
+      if (scoped)
+        slice = ClampTimeout(slice < milliseconds(0) ? CANCELLATION_CHECK_INTERVAL : std::min(slice, CANCELLATION_CHECK_INTERVAL));
+
+      const i32 count = ::epoll_wait(m_state->epoll.get(), events.data(), static_cast<i32>(events.size()), static_cast<i32>(slice.count()));
+
+      if (count < 0) {
+        if (errno == EINTR)
+          continue;
+
+        ERR_FMT(IoError, "Failed to wait for PSI triggers: {}", std::strerror(errno));
+      }
+
+      bool woken = false;
+
+      for (const epoll_event& event : Span<const epoll_event>(events.data(), static_cast<usize>(count))) {
+        if (event.data.u64 == WAKE_ID) {
+          u64 ignored = 0;
+          (void)::read(m_state->wakeup.get(), &ignored, sizeof(ignored));
+          woken = true;
+          continue;
+        }
+
+        // EPOLLERR means the cgroup went away; the trigger can't fire again.
+        const bool closed = (event.events & EPOLLERR) != 0;
+
+        if (closed)
+          m_state->triggers.erase(event.data.u64);
+
+        fired.push_back({ .trigger = event.data.u64, .closed = closed });
+      }
+
+      if (!fired.empty() || woken || (deadline && steady_clock::now() >= *deadline))
+        return fired;
+    }
+  }
+
+  fn PressureMonitor::wake() const -> Unit {
+    const u64 one = 1;
+    (void)::write(m_state->wakeup.get(), &one, sizeof(one));
+  }
+} // namespace draconis::services::pressure
+
+#endif // __linux__
@@ -24,12 +24,12 @@ fn MetNoService::getWeatherInfo() const -> Result<Report> {
   using glz::error_ctx, glz::read, glz::error_code;
 
   return GetCacheManager()->getOrSet<Report>(
-    "metno_weather",
-    [&]() -> Result<Report> {
+    "weather_metno",
+    [lat = m_lat, lon = m_lon, units = m_units]() -> Result<Report> {
       String responseBuffer;
 
       Curl::Easy curl({
-        .url                = std::format("https://api.met.no/weatherapi/locationforecast/2.0/compact?lat={:.4f}&lon={:.4f}", m_lat, m_lon),
+        .url                = std::format("https://api.met.no/weatherapi/locationforecast/2.0/compact?lat={:.4f}&lon={:.4f}", lat, lon),
         .writeBuffer        = &responseBuffer,
         .timeoutSecs        = 10L,
         .connectTimeoutSecs = 5L,
@@ -58,7 +58,7 @@ fn MetNoService::getWeatherInfo() const -> Result<Report> {
 
       f64 temp = data.instant.details.airTemperature;
 
-      if (m_units == UnitSystem::Imperial)
+      if (units == UnitSystem::Imperial)
         temp = temp * 9.0 / 5.0 + 32.0;
 
       String symbolCode = data.next1Hours ? data.next1Hours->summary.symbolCode : "";
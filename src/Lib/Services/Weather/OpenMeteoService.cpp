@@ -24,13 +24,13 @@ fn OpenMeteoService::getWeatherInfo() const -> Result<Report> {
   using glz::error_ctx, glz::read, glz::error_code;
 
   return GetCacheManager()->getOrSet<Report>(
-    "openmeteo_weather",
-    [&]() -> Result<Report> {
+    "weather_openmeteo",
+    [lat = m_lat, lon = m_lon, units = m_units]() -> Result<Report> {
       String url = std::format(
         "https://api.open-meteo.com/v1/forecast?latitude={:.4f}&longitude={:.4f}&current_weather=true&temperature_unit={}",
-        m_lat,
-        m_lon,
-        m_units == UnitSystem::Imperial ? "fahrenheit" : "celsius"
+        lat,
+        lon,
+        units == UnitSystem::Imperial ? "fahrenheit" : "celsius"
       );
 
       String responseBuffer;
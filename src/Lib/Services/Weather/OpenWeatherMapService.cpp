@@ -78,24 +78,24 @@ OpenWeatherMapService::OpenWeatherMapService(Location location, String apiKey, c
 
 fn OpenWeatherMapService::getWeatherInfo() const -> Result<Report> {
   return GetCacheManager()->getOrSet<Report>(
-    "owm_weather",
-    [&]() -> Result<Report> {
-      if (std::holds_alternative<String>(m_location)) {
-        const auto& city = std::get<String>(m_location);
+    "weather_owm",
+    [location = m_location, apiKey = m_apiKey, units = m_units]() -> Result<Report> {
+      if (std::holds_alternative<String>(location)) {
+        const auto& city = std::get<String>(location);
 
         Result<String> escapedUrl = Curl::Easy::escape(city);
         if (!escapedUrl)
           ERR_FROM(escapedUrl.error());
 
-        const String apiUrl = std::format("https://api.openweathermap.org/data/2.5/weather?q={}&appid={}&units={}", *escapedUrl, m_apiKey, m_units);
+        const String apiUrl = std::format("https://api.openweathermap.org/data/2.5/weather?q={}&appid={}&units={}", *escapedUrl, apiKey, units);
 
         return MakeApiRequest(apiUrl);
       }
 
-      if (std::holds_alternative<Coords>(m_location)) {
-        const auto& [lat, lon] = std::get<Coords>(m_location);
+      if (std::holds_alternative<Coords>(location)) {
+        const auto& [lat, lon] = std::get<Coords>(location);
 
-        const String apiUrl = std::format("https://api.openweathermap.org/data/2.5/weather?lat={:.3f}&lon={:.3f}&appid={}&units={}", lat, lon, m_apiKey, m_units);
+        const String apiUrl = std::format("https://api.openweathermap.org/data/2.5/weather?lat={:.3f}&lon={:.3f}&appid={}&units={}", lat, lon, apiKey, units);
 
         return MakeApiRequest(apiUrl);
       }
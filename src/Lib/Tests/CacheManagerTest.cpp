@@ -1,5 +1,9 @@
+#include <atomic>
 #include <chrono>
 #include <filesystem>
+#include <format>
+#include <fstream>
+#include <future>
 #include <thread>
 
 #include <Drac++/Utils/CacheManager.hpp>
@@ -11,26 +15,44 @@
 using namespace testing;
 using namespace draconis::utils;
 
+using cache::CacheKeyStats;
 using cache::CacheLocation;
 using cache::CacheManager;
 using cache::CachePolicy;
+using cache::MemoryBudget;
+using cache::CacheStorage;
+using cache::CacheValidator;
 
+using types::Array;
 using types::Err;
+using types::f64;
 using types::i32;
+using types::Map;
+using types::None;
 using types::Option;
 using types::PCStr;
 using types::Result;
 using types::String;
+using types::u64;
 using types::Unit;
+using types::usize;
+using types::Vec;
 
 namespace fs = std::filesystem;
 using namespace std::chrono_literals;
 
 class CacheManagerTest : public Test {
  protected:
+#ifdef _WIN32
+  static constexpr PCStr TEMP_ENV = "TMP"; // The first variable GetTempPath() checks.
+#else
+  static constexpr PCStr TEMP_ENV = "TMPDIR";
+#endif
+
   // NOLINTBEGIN(*-non-private-member-variables-in-classes)
-  fs::path      m_testDir;
-  Result<PCStr> m_originalHome;
+  fs::path       m_testDir;
+  Result<PCStr>  m_originalHome;
+  Option<String> m_originalTemp;
   // NOLINTEND(*-non-private-member-variables-in-classes)
 
   fn SetUp() -> Unit override {
@@ -40,13 +62,14 @@ class CacheManagerTest : public Test {
     if (fs::exists(m_testDir))
       fs::remove_all(m_testDir);
 
-    fs::create_directories(m_testDir);
+    fs::create_directories(m_testDir / "tmp");
+
+    // Point the temp directory cache inside the test directory, so the
+    // tests start empty without touching the user's real temp cache.
+    if (const Result<PCStr> temp = env::GetEnv(TEMP_ENV))
+      m_originalTemp = String(*temp);
 
-    // Clean up any existing temp directory cache files from previous test runs
-    // This is needed because TempDirectoryCache test uses /tmp/temp_key
-    fs::path tempKeyFile = fs::temp_directory_path() / "temp_key";
-    if (fs::exists(tempKeyFile))
-      fs::remove(tempKeyFile);
+    env::SetEnv(TEMP_ENV, (m_testDir / "tmp").string().c_str());
 
     // Set environment variable for test
     m_originalHome = env::GetEnv("HOME");
@@ -68,6 +91,11 @@ class CacheManagerTest : public Test {
     else
       env::UnsetEnv("HOME");
 
+    if (m_originalTemp)
+      env::SetEnv(TEMP_ENV, m_originalTemp->c_str());
+    else
+      env::UnsetEnv(TEMP_ENV);
+
     // Clean up test directory
     if (fs::exists(m_testDir))
       fs::remove_all(m_testDir);
@@ -149,6 +177,122 @@ TEST_F(CacheManagerTest, FetcherFailure) {
   EXPECT_EQ(result.error().message, "Fetch failed");
 }
 
+TEST_F(CacheManagerTest, NegativeCaching) {
+  CachePolicy policy = CachePolicy::inMemory();
+  policy.negativeTtl = std::chrono::hours(1);
+
+  CacheManager cache;
+  cache.setGlobalPolicy(policy);
+
+  i32  notFoundCount   = 0;
+  auto notFoundFetcher = [&notFoundCount]() -> Result<i32> {
+    notFoundCount++;
+    ERR(error::DracErrorCode::NotFound, "Not installed");
+  };
+
+  // Absent resources are remembered, error and all.
+  for (i32 i = 0; i < 3; ++i) {
+    auto result = cache.getOrSet<i32>("missing_key", notFoundFetcher);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().code, error::DracErrorCode::NotFound);
+    EXPECT_EQ(result.error().message, "Not installed");
+  }
+
+  EXPECT_EQ(notFoundCount, 1);
+
+  // Anything else is retried every time.
+  i32  ioErrorCount   = 0;
+  auto ioErrorFetcher = [&ioErrorCount]() -> Result<i32> {
+    ioErrorCount++;
+    ERR(error::DracErrorCode::IoError, "Read failed");
+  };
+
+  EXPECT_FALSE(cache.getOrSet<i32>("flaky_key", ioErrorFetcher).has_value());
+  EXPECT_FALSE(cache.getOrSet<i32>("flaky_key", ioErrorFetcher).has_value());
+  EXPECT_EQ(ioErrorCount, 2);
+
+  // Without a negative TTL nothing is remembered.
+  EXPECT_FALSE(cache.getOrSet<i32>("uncached_key", CachePolicy::inMemory(), notFoundFetcher).has_value());
+  EXPECT_FALSE(cache.getOrSet<i32>("uncached_key", CachePolicy::inMemory(), notFoundFetcher).has_value());
+  EXPECT_EQ(notFoundCount, 3);
+}
+
+TEST_F(CacheManagerTest, NegativeCachingPersists) {
+  CachePolicy policy = CachePolicy::neverExpire();
+  policy.negativeTtl = std::chrono::hours(1);
+
+  i32  fetchCount = 0;
+  auto fetcher    = [&fetchCount]() -> Result<i32> {
+    fetchCount++;
+    ERR(error::DracErrorCode::NotSupported, "Not supported here");
+  };
+
+  {
+    CacheManager cache;
+    EXPECT_FALSE(cache.getOrSet<i32>("unsupported_key", policy, fetcher).has_value());
+  }
+
+  CacheManager cache;
+  auto         result = cache.getOrSet<i32>("unsupported_key", policy, fetcher);
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code, error::DracErrorCode::NotSupported);
+  EXPECT_EQ(fetchCount, 1);
+
+  // A success replaces the remembered failure once it's invalidated.
+  cache.invalidate("unsupported_key");
+  EXPECT_EQ(*cache.getOrSet<i32>("unsupported_key", policy, createCountingFetcher(fetchCount, 42)), 42);
+  EXPECT_EQ(*cache.getOrSet<i32>("unsupported_key", policy, fetcher), 42);
+}
+
+TEST_F(CacheManagerTest, StatsCountHitsAndMisses) {
+  CacheManager cache;
+  cache.setGlobalPolicy({ .location = CacheLocation::TempDirectory, .ttl = std::chrono::hours(1) });
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  EXPECT_EQ(*cache.getOrSet<i32>("temp_key", fetcher), 42);
+  EXPECT_EQ(*cache.getOrSet<i32>("temp_key", fetcher), 42);
+  EXPECT_FALSE(cache.getOrSet<i32>("error_key", createFailingFetcher()).has_value());
+
+  Map<String, CacheKeyStats> stats = cache.stats();
+
+  ASSERT_TRUE(stats.contains("temp_key"));
+  EXPECT_EQ(stats["temp_key"].misses, 1U);
+  EXPECT_EQ(stats["temp_key"].memoryHits, 1U);
+  EXPECT_EQ(stats["temp_key"].diskHits, 0U);
+  EXPECT_GT(stats["temp_key"].bytesWritten, 0U);
+
+  u64 bucketed = 0;
+
+  for (const u64 count : stats["temp_key"].fetchLatency)
+    bucketed += count;
+
+  EXPECT_EQ(bucketed, 1U);
+
+  ASSERT_TRUE(stats.contains("error_key"));
+  EXPECT_EQ(stats["error_key"].misses, 1U);
+  EXPECT_EQ(stats["error_key"].fetchFailures, 1U);
+
+  // A fresh manager starts from zero and finds the entry on disk.
+  CacheManager newCache;
+  newCache.setGlobalPolicy({ .location = CacheLocation::TempDirectory, .ttl = std::chrono::hours(1) });
+
+  EXPECT_EQ(*newCache.getOrSet<i32>("temp_key", fetcher), 42);
+  EXPECT_EQ(fetchCount, 1);
+
+  stats = newCache.stats();
+
+  EXPECT_EQ(stats["temp_key"].diskHits, 1U);
+  EXPECT_EQ(stats["temp_key"].misses, 0U);
+  EXPECT_GT(stats["temp_key"].bytesRead, 0U);
+
+  newCache.resetStats();
+  EXPECT_TRUE(newCache.stats().empty());
+}
+
 // Test with custom struct
 struct TestData {
   i32    value;
@@ -252,6 +396,243 @@ TEST_F(CacheManagerTest, TempDirectoryCache) {
   EXPECT_EQ(fetchCount, 1); // Fetcher should not be called again
 }
 
+TEST_F(CacheManagerTest, PerKeyFilesCache) {
+  const CachePolicy policy { .location = CacheLocation::TempDirectory, .ttl = std::chrono::hours(24), .storage = CacheStorage::PerKeyFiles };
+
+  CacheManager cache;
+  cache.setGlobalPolicy(policy);
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  EXPECT_EQ(*cache.getOrSet<i32>("temp_key", fetcher), 42);
+  EXPECT_EQ(fetchCount, 1);
+  EXPECT_TRUE(fs::exists(CacheManager::getTempCacheDir() / "temp_key"));
+
+  CacheManager newCache;
+  newCache.setGlobalPolicy(policy);
+
+  EXPECT_EQ(*newCache.getOrSet<i32>("temp_key", fetcher), 42);
+  EXPECT_EQ(fetchCount, 1);
+}
+
+TEST_F(CacheManagerTest, UntilRebootKeepsTheGlobalLocation) {
+  CacheManager cache;
+  cache.setGlobalPolicy(CachePolicy::inMemory());
+
+  const CachePolicy policy = CachePolicy::untilReboot(cache.getGlobalPolicy());
+
+  EXPECT_EQ(policy.location, CacheLocation::InMemory);
+  EXPECT_FALSE(policy.ttl.has_value());
+  EXPECT_TRUE(policy.bootScoped);
+}
+
+TEST_F(CacheManagerTest, BootScopedEntriesLastTheBoot) {
+  const CachePolicy bootPolicy = CachePolicy::untilReboot(CachePolicy::tempDirectory());
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  {
+    CacheManager cache;
+    EXPECT_EQ(*cache.getOrSet<i32>("temp_key", bootPolicy, fetcher), 42);
+  }
+
+  CacheManager cache;
+  EXPECT_EQ(*cache.getOrSet<i32>("temp_key", bootPolicy, fetcher), 42);
+  EXPECT_EQ(fetchCount, 1);
+
+  // The entry carries the boot stamp, so a lookup that isn't boot-scoped doesn't match it.
+  CachePolicy plainPolicy = bootPolicy;
+  plainPolicy.bootScoped  = false;
+
+  CacheManager otherCache;
+  EXPECT_EQ(*otherCache.getOrSet<i32>("temp_key", plainPolicy, fetcher), 42);
+  EXPECT_EQ(fetchCount, 2);
+}
+
+TEST_F(CacheManagerTest, InvalidateAllOnlyTouchesOwnTempFiles) {
+  // An extension-less file in the system temp dir that isn't ours.
+  const fs::path foreignFile = fs::temp_directory_path() / "draconis_foreign_file";
+  std::ofstream(foreignFile) << "not a cache entry";
+
+  CacheManager cache;
+  cache.setGlobalPolicy({ .location = CacheLocation::TempDirectory, .ttl = std::chrono::hours(24), .storage = CacheStorage::PerKeyFiles });
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  EXPECT_EQ(*cache.getOrSet<i32>("temp_key", fetcher), 42);
+  EXPECT_EQ(*cache.getOrSet<i32>("other_key", fetcher), 42);
+
+  EXPECT_EQ(cache.invalidateAll(), 2);
+
+  EXPECT_FALSE(fs::exists(CacheManager::getTempCacheDir() / "temp_key"));
+  EXPECT_FALSE(fs::exists(CacheManager::getTempCacheDir() / "other_key"));
+  EXPECT_TRUE(fs::exists(foreignFile));
+
+  fs::remove(foreignFile);
+
+  // The manifest starts over, so entries written afterwards are still cleared.
+  EXPECT_EQ(*cache.getOrSet<i32>("temp_key", fetcher), 42);
+  EXPECT_EQ(fetchCount, 3);
+  EXPECT_EQ(cache.invalidateAll(), 1);
+}
+
+namespace {
+  // Deliberately have no glz::meta: raw types never go through glaze.
+  struct RawPoint {
+    i32    x;
+    i32    y;
+    f64    weight;
+
+    fn operator==(const RawPoint&) const -> bool = default;
+  };
+
+  struct RawQuad {
+    Array<i32, 4> values;
+
+    fn operator==(const RawQuad&) const -> bool = default;
+  };
+} // namespace
+
+namespace draconis::utils::cache {
+  template <>
+  struct RawCacheLayout<RawPoint> : RawLayoutVersion<1> {};
+
+  template <>
+  struct RawCacheLayout<RawQuad> : RawLayoutVersion<1> {};
+} // namespace draconis::utils::cache
+
+// Only plain data opts in; pointers and views would be read back dangling by another process.
+static_assert(cache::RawCacheLayout<u64>::enabled && cache::RawCacheLayout<types::CPUCores>::enabled);
+static_assert(!cache::RawCacheLayout<PCStr>::enabled && !cache::RawCacheLayout<types::StringView>::enabled);
+
+TEST_F(CacheManagerTest, RawLayoutEntriesAreRaw) {
+  const CachePolicy policy { .location = CacheLocation::TempDirectory, .ttl = std::chrono::hours(1), .storage = CacheStorage::PerKeyFiles };
+
+  const RawPoint point { .x = 3, .y = -4, .weight = 0.5 };
+
+  i32  fetchCount = 0;
+  auto fetcher    = [&fetchCount, point]() -> Result<RawPoint> {
+    fetchCount++;
+    return point;
+  };
+
+  {
+    CacheManager cache;
+    EXPECT_EQ(*cache.getOrSet<RawPoint>("temp_key", policy, fetcher), point);
+  }
+
+  // Header (24 bytes) plus the value itself.
+  EXPECT_EQ(fs::file_size(CacheManager::getTempCacheDir() / "temp_key"), 24 + sizeof(RawPoint));
+
+  CacheManager cache;
+  EXPECT_EQ(*cache.getOrSet<RawPoint>("temp_key", policy, fetcher), point);
+  EXPECT_EQ(fetchCount, 1);
+
+  // Reading the entry back as a different type of the same size is a miss, not a reinterpretation.
+  i32  otherCount   = 0;
+  auto otherFetcher = [&otherCount]() -> Result<RawQuad> {
+    otherCount++;
+    return RawQuad { .values = { 1, 2, 3, 4 } };
+  };
+
+  CacheManager otherCache;
+  EXPECT_EQ(*otherCache.getOrSet<RawQuad>("temp_key", policy, otherFetcher), (RawQuad { .values = { 1, 2, 3, 4 } }));
+  EXPECT_EQ(otherCount, 1);
+  EXPECT_EQ(otherCache.stats()["temp_key"].decodeFailures, 1U);
+}
+
+TEST_F(CacheManagerTest, GetOrSetManyResolvesInOrder) {
+  CacheManager cache;
+  cache.setGlobalPolicy(CachePolicy::inMemory());
+
+  i32  intCount = 0;
+  auto intFetch = createCountingFetcher(intCount, 42);
+
+  // Warm one key so the batch mixes a hit with misses.
+  EXPECT_EQ(*cache.getOrSet<i32>("int_key", intFetch), 42);
+
+  i32  stringCount = 0;
+  auto stringFetch = [&stringCount]() -> Result<String> {
+    stringCount++;
+    return "hello";
+  };
+
+  i32  failCount = 0;
+  auto failFetch = [&failCount]() -> Result<u64> {
+    failCount++;
+    ERR(error::DracErrorCode::NotFound, "nothing here");
+  };
+
+  auto [intResult, stringResult, failResult] = cache.getOrSetMany(
+    cache::CacheRequest<i32> { .key = "int_key", .fetcher = intFetch },
+    cache::CacheRequest<String> { .key = "string_key", .fetcher = stringFetch },
+    cache::CacheRequest<u64> { .key = "fail_key", .fetcher = failFetch }
+  );
+
+  EXPECT_EQ(*intResult, 42);
+  EXPECT_EQ(*stringResult, "hello");
+  ASSERT_FALSE(failResult.has_value());
+  EXPECT_EQ(failResult.error().code, error::DracErrorCode::NotFound);
+
+  EXPECT_EQ(intCount, 1);
+  EXPECT_EQ(stringCount, 1);
+  EXPECT_EQ(failCount, 1);
+
+  EXPECT_EQ(*cache.getOrSet<String>("string_key", stringFetch), "hello");
+  EXPECT_EQ(stringCount, 1);
+}
+
+TEST_F(CacheManagerTest, WriteBatchDefersDiskWrites) {
+  const CachePolicy policy { .location = CacheLocation::TempDirectory, .ttl = std::chrono::hours(1), .storage = CacheStorage::PerKeyFiles };
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 7);
+
+  const fs::path entryPath = CacheManager::getTempCacheDir() / "temp_key";
+
+  {
+    CacheManager cache;
+
+    {
+      const CacheManager::WriteBatch batch(cache);
+
+      EXPECT_EQ(*cache.getOrSet<i32>("temp_key", policy, fetcher), 7);
+      EXPECT_FALSE(fs::exists(entryPath));
+
+      // Still served from memory while the write is queued.
+      EXPECT_EQ(*cache.getOrSet<i32>("temp_key", policy, fetcher), 7);
+      EXPECT_EQ(fetchCount, 1);
+    }
+
+    EXPECT_TRUE(fs::exists(entryPath));
+  }
+
+  CacheManager cache;
+  EXPECT_EQ(*cache.getOrSet<i32>("temp_key", policy, fetcher), 7);
+  EXPECT_EQ(fetchCount, 1);
+}
+
+TEST_F(CacheManagerTest, InvalidateRemovesFromMappedStore) {
+  CacheManager cache;
+  cache.setGlobalPolicy({ .location = CacheLocation::TempDirectory, .ttl = std::chrono::hours(24) });
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  EXPECT_EQ(*cache.getOrSet<i32>("temp_key", fetcher), 42);
+  cache.invalidate("temp_key");
+
+  // A fresh manager must not find the entry in the store file either.
+  CacheManager newCache;
+  newCache.setGlobalPolicy({ .location = CacheLocation::TempDirectory, .ttl = std::chrono::hours(24) });
+
+  EXPECT_EQ(*newCache.getOrSet<i32>("temp_key", fetcher), 42);
+  EXPECT_EQ(fetchCount, 2);
+}
+
 // TODO Fix PersistentDirectoryCache test
 
 // TEST_F(CacheManagerTest, PersistentDirectoryCache) {
@@ -334,6 +715,64 @@ TEST_F(CacheManagerTest, MemoryCacheTTL) {
   EXPECT_EQ(fetchCount, 2);
 }
 
+TEST_F(CacheManagerTest, MemoryBudgetEvictsLeastRecentlyUsed) {
+  CacheManager cache;
+  cache.setGlobalPolicy(CachePolicy::inMemory());
+  cache.setMemoryBudget({ .maxEntries = 2, .maxBytes = 0 });
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  (void)cache.getOrSet<i32>("a", fetcher);
+  (void)cache.getOrSet<i32>("b", fetcher);
+
+  // Touch "a" so "b" becomes the least recently used entry.
+  (void)cache.getOrSet<i32>("a", fetcher);
+  (void)cache.getOrSet<i32>("c", fetcher);
+
+  EXPECT_EQ(fetchCount, 3);
+  EXPECT_EQ(cache.memoryUsage().first, 2U);
+  EXPECT_EQ(cache.stats()["b"].evictions, 1U);
+
+  (void)cache.getOrSet<i32>("a", fetcher);
+  EXPECT_EQ(fetchCount, 3);
+
+  (void)cache.getOrSet<i32>("b", fetcher);
+  EXPECT_EQ(fetchCount, 4);
+}
+
+TEST_F(CacheManagerTest, MemoryBudgetLimitsBytes) {
+  CacheManager cache;
+  cache.setGlobalPolicy(CachePolicy::inMemory());
+  cache.setMemoryBudget({ .maxEntries = 0, .maxBytes = 64 * 1024 });
+
+  for (i32 i = 0; i < 16; ++i)
+    (void)cache.getOrSet<String>(std::format("big_{}", i), []() -> Result<String> { return String(16 * 1024, 'x'); });
+
+  const auto [entries, bytes] = cache.memoryUsage();
+
+  EXPECT_LT(entries, 16U);
+  EXPECT_LE(bytes, 64U * 1024);
+}
+
+TEST_F(CacheManagerTest, PurgeExpired) {
+  CacheManager cache;
+  cache.setGlobalPolicy({ .location = CacheLocation::InMemory, .ttl = 1s });
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  (void)cache.getOrSet<i32>("short_key", fetcher);
+  (void)cache.getOrSet<i32>("long_key", CachePolicy::inMemory(), fetcher);
+
+  EXPECT_EQ(cache.purgeExpired(), 0U);
+
+  std::this_thread::sleep_for(1100ms);
+
+  EXPECT_EQ(cache.purgeExpired(), 1U);
+  EXPECT_EQ(cache.memoryUsage().first, 1U);
+}
+
 TEST_F(CacheManagerTest, PersistentCacheTTL) {
   using namespace std::chrono_literals;
 
@@ -359,6 +798,47 @@ TEST_F(CacheManagerTest, PersistentCacheTTL) {
   EXPECT_EQ(fetchCount, 2);
 }
 
+TEST_F(CacheManagerTest, StaleWhileRevalidate) {
+  CacheManager cache;
+  cache.setGlobalPolicy({ .location = CacheLocation::InMemory, .ttl = 1s, .staleWhileRevalidate = 1h });
+
+  // Background refreshes may outlive a stack frame, so the fetcher shares its counter.
+  const auto fetchCount = std::make_shared<std::atomic<i32>>(0);
+  const auto fetcher    = [fetchCount]() -> Result<i32> { return ++*fetchCount; };
+
+  EXPECT_EQ(*cache.getOrSet<i32>("swr_key", fetcher), 1);
+
+  std::this_thread::sleep_for(1100ms);
+
+  // The expired value is served immediately while a refresh runs in the background.
+  EXPECT_EQ(*cache.getOrSet<i32>("swr_key", fetcher), 1);
+
+  for (i32 i = 0; i < 200 && fetchCount->load() < 2; ++i)
+    std::this_thread::sleep_for(10ms);
+
+  ASSERT_EQ(fetchCount->load(), 2);
+  EXPECT_EQ(*cache.getOrSet<i32>("swr_key", fetcher), 2);
+}
+
+TEST_F(CacheManagerTest, RefreshAhead) {
+  CacheManager cache;
+  cache.setGlobalPolicy({ .location = CacheLocation::InMemory, .ttl = 1h, .refreshAhead = 2h });
+
+  const auto fetchCount = std::make_shared<std::atomic<i32>>(0);
+  const auto fetcher    = [fetchCount]() -> Result<i32> { return ++*fetchCount; };
+
+  EXPECT_EQ(*cache.getOrSet<i32>("refresh_ahead_key", fetcher), 1);
+
+  // The entry is already inside the refresh-ahead window, so a hit returns it
+  // and also schedules a refresh.
+  EXPECT_EQ(*cache.getOrSet<i32>("refresh_ahead_key", fetcher), 1);
+
+  for (i32 i = 0; i < 200 && fetchCount->load() < 2; ++i)
+    std::this_thread::sleep_for(10ms);
+
+  EXPECT_EQ(fetchCount->load(), 2);
+}
+
 TEST_F(CacheManagerTest, NeverExpire) {
   CacheManager cache;
   cache.setGlobalPolicy(CachePolicy::neverExpire());
@@ -378,6 +858,43 @@ TEST_F(CacheManagerTest, NeverExpire) {
   EXPECT_EQ(fetchCount, 1);
 }
 
+TEST_F(CacheManagerTest, SourceChangeInvalidates) {
+  const fs::path source = m_testDir / "source.db";
+
+  { std::ofstream(source) << "one"; }
+
+  const CacheValidator validator { .sources = { source } };
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  {
+    CacheManager cache;
+
+    EXPECT_EQ(*cache.getOrSet<i32>("validated_key", CachePolicy::neverExpire(), validator, fetcher), 42);
+    EXPECT_EQ(*cache.getOrSet<i32>("validated_key", CachePolicy::neverExpire(), validator, fetcher), 42);
+    EXPECT_EQ(fetchCount, 1);
+  }
+
+  // An untouched source is still a hit from disk in a fresh manager.
+  CacheManager cache;
+
+  EXPECT_EQ(*cache.getOrSet<i32>("validated_key", CachePolicy::neverExpire(), validator, fetcher), 42);
+  EXPECT_EQ(fetchCount, 1);
+
+  // Growing the file changes its size, so the stamp no longer matches.
+  { std::ofstream(source, std::ios::app) << "two"; }
+
+  EXPECT_EQ(*cache.getOrSet<i32>("validated_key", CachePolicy::neverExpire(), validator, fetcher), 42);
+  EXPECT_EQ(fetchCount, 2);
+
+  // A source that disappears is a change too.
+  fs::remove(source);
+
+  EXPECT_EQ(*cache.getOrSet<i32>("validated_key", CachePolicy::neverExpire(), validator, fetcher), 42);
+  EXPECT_EQ(fetchCount, 3);
+}
+
 TEST_F(CacheManagerTest, TTLOverride) {
   using namespace std::chrono_literals;
 
@@ -407,6 +924,148 @@ TEST_F(CacheManagerTest, TTLOverride) {
   EXPECT_EQ(fetchCount, 2);
 }
 
+TEST_F(CacheManagerTest, KeyPolicyAppliesToMatchingKeysOnly) {
+  CacheManager cache;
+  cache.setGlobalPolicy(CachePolicy::inMemory());
+  cache.setKeyPolicy("weather_", { .location = CacheLocation::InMemory, .ttl = 1s });
+  cache.setKeyPolicy("weather_slow_", CachePolicy::inMemory());
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  for (const PCStr key : { "weather_now", "weather_slow_now", "other_key" })
+    EXPECT_EQ(*cache.getOrSet<i32>(key, fetcher), 42);
+
+  EXPECT_EQ(fetchCount, 3);
+
+  std::this_thread::sleep_for(1100ms);
+
+  // Only the key under the short "weather_" policy has expired; the longer prefix wins for "weather_slow_now".
+  for (const PCStr key : { "weather_now", "weather_slow_now", "other_key" })
+    EXPECT_EQ(*cache.getOrSet<i32>(key, fetcher), 42);
+
+  EXPECT_EQ(fetchCount, 4);
+}
+
+TEST_F(CacheManagerTest, KeyPolicyKeepsTheCallersPolicy) {
+  CacheManager cache;
+  cache.setKeyPolicy("pkg_count_", { .location = CacheLocation::InMemory, .ttl = 1s, .staleWhileRevalidate = 1h });
+
+  // What the package counters pass: no expiry, and a missing manager is remembered.
+  CachePolicy countPolicy = CachePolicy::inMemory();
+  countPolicy.ttl         = None;
+  countPolicy.negativeTtl = std::chrono::hours(1);
+
+  i32  notFoundCount   = 0;
+  auto notFoundFetcher = [&notFoundCount]() -> Result<i32> {
+    notFoundCount++;
+    ERR(error::DracErrorCode::NotFound, "Not installed");
+  };
+
+  for (i32 i = 0; i < 3; ++i)
+    EXPECT_FALSE(cache.getOrSet<i32>("pkg_count_missing", countPolicy, notFoundFetcher).has_value());
+
+  EXPECT_EQ(notFoundCount, 1);
+
+  i32  fetchCount = 0;
+  auto fetcher    = createCountingFetcher(fetchCount, 42);
+
+  EXPECT_EQ(*cache.getOrSet<i32>("pkg_count_found", countPolicy, fetcher), 42);
+
+  std::this_thread::sleep_for(1100ms);
+
+  // The key policy's 1s TTL doesn't replace the caller's.
+  EXPECT_EQ(*cache.getOrSet<i32>("pkg_count_found", countPolicy, fetcher), 42);
+  EXPECT_EQ(fetchCount, 1);
+}
+
+TEST_F(CacheManagerTest, MemoryEntryTypeMismatchIsMiss) {
+  CacheManager cache;
+  cache.setGlobalPolicy(CachePolicy::inMemory());
+
+  i32 intFetchCount = 0;
+  EXPECT_EQ(*cache.getOrSet<i32>("typed_key", createCountingFetcher(intFetchCount, 7)), 7);
+
+  // The in-memory tier stores decoded values, so asking for a different type
+  // under the same key must not reinterpret the stored i32.
+  i32  strFetchCount = 0;
+  auto strFetcher    = [&strFetchCount]() -> Result<String> {
+    strFetchCount++;
+    return "seven";
+  };
+
+  EXPECT_EQ(*cache.getOrSet<String>("typed_key", strFetcher), "seven");
+  EXPECT_EQ(strFetchCount, 1);
+
+  EXPECT_EQ(*cache.getOrSet<String>("typed_key", strFetcher), "seven");
+  EXPECT_EQ(strFetchCount, 1);
+}
+
+// Concurrency tests
+TEST_F(CacheManagerTest, ConcurrentSameKeyFetchesOnce) {
+  CacheManager cache;
+  cache.setGlobalPolicy(CachePolicy::inMemory());
+
+  std::atomic<i32> fetchCount = 0;
+
+  const auto fetcher = [&fetchCount]() -> Result<i32> {
+    fetchCount++;
+    std::this_thread::sleep_for(100ms);
+    return 42;
+  };
+
+  constexpr usize threadCount = 8;
+
+  Vec<std::future<Result<i32>>> results;
+  results.reserve(threadCount);
+
+  for (usize i = 0; i < threadCount; ++i)
+    results.emplace_back(std::async(std::launch::async, [&] { return cache.getOrSet<i32>("single_flight_key", fetcher); }));
+
+  for (std::future<Result<i32>>& result : results) {
+    Result<i32> value = result.get();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(*value, 42);
+  }
+
+  EXPECT_EQ(fetchCount.load(), 1); // Waiters should reuse the in-flight result
+}
+
+TEST_F(CacheManagerTest, SlowFetchDoesNotBlockOtherKeys) {
+  CacheManager cache;
+  cache.setGlobalPolicy(CachePolicy::inMemory());
+
+  std::promise<Unit> started;
+  std::promise<Unit> release;
+
+  std::shared_future<Unit> releaseFuture = release.get_future().share();
+
+  std::future<Result<i32>> slow = std::async(std::launch::async, [&] {
+    return cache.getOrSet<i32>("slow_key", [&]() -> Result<i32> {
+      started.set_value();
+      releaseFuture.wait_for(2s);
+      return 1;
+    });
+  });
+
+  started.get_future().wait();
+
+  // The slow fetcher is still running; an unrelated key must not wait for it.
+  const auto  begin = std::chrono::steady_clock::now();
+  Result<i32> fast  = cache.getOrSet<i32>("fast_key", []() -> Result<i32> { return 2; });
+  const auto  took  = std::chrono::steady_clock::now() - begin;
+
+  release.set_value();
+
+  ASSERT_TRUE(fast.has_value());
+  EXPECT_EQ(*fast, 2);
+  EXPECT_LT(took, 1s);
+
+  Result<i32> slowResult = slow.get();
+  ASSERT_TRUE(slowResult.has_value());
+  EXPECT_EQ(*slowResult, 1);
+}
+
 fn main(i32 argc, char** argv) -> i32 {
   InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,241 @@
+#include <filesystem>
+#include <fstream>
+
+#include <Drac++/Utils/CacheStore.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+
+using cache::CacheStore;
+
+using types::Array;
+using types::i32;
+using types::Pair;
+using types::Result;
+using types::String;
+using types::StringView;
+using types::UniquePointer;
+using types::Unit;
+
+namespace fs = std::filesystem;
+
+class CacheStoreTest : public Test {
+ protected:
+  // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+  fs::path m_testDir;
+  fs::path m_storePath;
+  // NOLINTEND(*-non-private-member-variables-in-classes)
+
+  fn SetUp() -> Unit override {
+    m_testDir   = fs::temp_directory_path() / "draconis_cache_store_test";
+    m_storePath = m_testDir / "store.cache";
+
+    if (fs::exists(m_testDir))
+      fs::remove_all(m_testDir);
+  }
+
+  fn TearDown() -> Unit override {
+    if (fs::exists(m_testDir))
+      fs::remove_all(m_testDir);
+  }
+
+  fn openStore() const -> UniquePointer<CacheStore> {
+    Result<UniquePointer<CacheStore>> store = CacheStore::open(m_storePath);
+    EXPECT_TRUE(store.has_value());
+    return store ? std::move(*store) : nullptr;
+  }
+};
+
+TEST_F(CacheStoreTest, PutThenGet) {
+  UniquePointer<CacheStore> store = openStore();
+  ASSERT_NE(store, nullptr);
+
+  EXPECT_FALSE(store->get("missing").has_value());
+
+  ASSERT_TRUE(store->put("key", "value").has_value());
+  EXPECT_EQ(store->get("key"), "value");
+}
+
+TEST_F(CacheStoreTest, SurvivesReopen) {
+  {
+    UniquePointer<CacheStore> store = openStore();
+    ASSERT_NE(store, nullptr);
+    ASSERT_TRUE(store->put("a", "first").has_value());
+    ASSERT_TRUE(store->put("b", String("\0binary\0", 8)).has_value());
+  }
+
+  UniquePointer<CacheStore> store = openStore();
+  ASSERT_NE(store, nullptr);
+
+  EXPECT_EQ(store->get("a"), "first");
+  EXPECT_EQ(store->get("b"), String("\0binary\0", 8));
+}
+
+TEST_F(CacheStoreTest, LaterPutSupersedes) {
+  {
+    UniquePointer<CacheStore> store = openStore();
+    ASSERT_NE(store, nullptr);
+    ASSERT_TRUE(store->put("key", "old").has_value());
+    ASSERT_TRUE(store->put("key", "new").has_value());
+    EXPECT_EQ(store->get("key"), "new");
+  }
+
+  EXPECT_EQ(openStore()->get("key"), "new");
+}
+
+TEST_F(CacheStoreTest, PutManySurvivesReopen) {
+  {
+    UniquePointer<CacheStore> store = openStore();
+    ASSERT_NE(store, nullptr);
+
+    const Array<Pair<StringView, StringView>, 3> entries = { {
+      { "a", "first" },
+      { "b", "second" },
+      { "a", "third" },
+    } };
+
+    ASSERT_TRUE(store->putMany(entries).has_value());
+    EXPECT_EQ(store->get("a"), "third");
+    EXPECT_EQ(store->get("b"), "second");
+  }
+
+  UniquePointer<CacheStore> store = openStore();
+  ASSERT_NE(store, nullptr);
+
+  EXPECT_EQ(store->get("a"), "third");
+  EXPECT_EQ(store->get("b"), "second");
+}
+
+TEST_F(CacheStoreTest, EraseSurvivesReopen) {
+  {
+    UniquePointer<CacheStore> store = openStore();
+    ASSERT_NE(store, nullptr);
+    ASSERT_TRUE(store->put("key", "value").has_value());
+    ASSERT_TRUE(store->erase("key").has_value());
+    EXPECT_FALSE(store->get("key").has_value());
+  }
+
+  EXPECT_FALSE(openStore()->get("key").has_value());
+}
+
+TEST_F(CacheStoreTest, SeesWritesFromAnotherHandle) {
+  UniquePointer<CacheStore> first  = openStore();
+  UniquePointer<CacheStore> second = openStore();
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+
+  ASSERT_TRUE(first->put("a", "1").has_value());
+
+  // The second handle picks up the first one's records the next time it writes.
+  ASSERT_TRUE(second->put("b", "2").has_value());
+  EXPECT_EQ(second->get("a"), "1");
+  EXPECT_EQ(second->get("b"), "2");
+}
+
+TEST_F(CacheStoreTest, GetSeesAppendsFromAnotherHandle) {
+  UniquePointer<CacheStore> first  = openStore();
+  UniquePointer<CacheStore> second = openStore();
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+
+  ASSERT_TRUE(first->put("a", "1").has_value());
+  EXPECT_EQ(second->get("a"), "1");
+
+  // Also after the file has been replaced under the second handle.
+  ASSERT_TRUE(first->compact().has_value());
+  ASSERT_TRUE(first->put("b", "2").has_value());
+  EXPECT_EQ(second->get("b"), "2");
+  EXPECT_EQ(second->get("a"), "1");
+}
+
+TEST_F(CacheStoreTest, CompactionKeepsLiveEntries) {
+  UniquePointer<CacheStore> store = openStore();
+  ASSERT_NE(store, nullptr);
+
+  const String bigValue(1024, 'x');
+
+  for (i32 i = 0; i < 32; ++i)
+    ASSERT_TRUE(store->put("churn", bigValue).has_value());
+
+  ASSERT_TRUE(store->put("keep", "kept").has_value());
+
+  const auto sizeBefore = fs::file_size(m_storePath);
+
+  ASSERT_TRUE(store->compact().has_value());
+
+  EXPECT_LT(fs::file_size(m_storePath), sizeBefore);
+  EXPECT_EQ(store->get("churn"), bigValue);
+  EXPECT_EQ(store->get("keep"), "kept");
+
+  EXPECT_EQ(openStore()->get("keep"), "kept");
+}
+
+TEST_F(CacheStoreTest, IgnoresUncommittedTail) {
+  {
+    UniquePointer<CacheStore> store = openStore();
+    ASSERT_NE(store, nullptr);
+    ASSERT_TRUE(store->put("key", "value").has_value());
+  }
+
+  // Simulate a write that was interrupted before the header was updated.
+  {
+    std::ofstream ofs(m_storePath, std::ios::binary | std::ios::app);
+    ofs << "garbage that was never committed";
+  }
+
+  UniquePointer<CacheStore> store = openStore();
+  ASSERT_NE(store, nullptr);
+
+  EXPECT_EQ(store->get("key"), "value");
+  ASSERT_TRUE(store->put("other", "value").has_value());
+  EXPECT_EQ(openStore()->get("other"), "value");
+}
+
+TEST_F(CacheStoreTest, ResetsCorruptFile) {
+  fs::create_directories(m_testDir);
+
+  {
+    std::ofstream ofs(m_storePath, std::ios::binary);
+    ofs << "not a cache store";
+  }
+
+  UniquePointer<CacheStore> store = openStore();
+  ASSERT_NE(store, nullptr);
+
+  EXPECT_FALSE(store->get("key").has_value());
+  ASSERT_TRUE(store->put("key", "value").has_value());
+  EXPECT_EQ(store->get("key"), "value");
+}
+
+#ifndef _WIN32
+TEST_F(CacheStoreTest, ResetLeavesOtherMappingsIntact) {
+  UniquePointer<CacheStore> first = openStore();
+  ASSERT_NE(first, nullptr);
+  ASSERT_TRUE(first->put("key", "value").has_value());
+
+  // Clobber the magic in place, so the next handle to open the file resets it.
+  {
+    std::fstream file(m_storePath, std::ios::in | std::ios::out | std::ios::binary);
+    file << "XXXXXXXX";
+  }
+
+  UniquePointer<CacheStore> second = openStore();
+  ASSERT_NE(second, nullptr);
+  EXPECT_FALSE(second->get("key").has_value());
+
+  // The reset swapped in a new file rather than truncating the one still mapped here.
+  EXPECT_EQ(first->get("key"), "value");
+  EXPECT_FALSE(fs::exists(fs::path(m_storePath).concat(".compact")));
+
+  ASSERT_TRUE(first->put("other", "value").has_value());
+  EXPECT_EQ(openStore()->get("other"), "value");
+}
+#endif
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
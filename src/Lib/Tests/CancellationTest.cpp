@@ -0,0 +1,102 @@
+#include <future>
+#include <stop_token>
+
+#include <Drac++/Utils/Cancellation.hpp>
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Task.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::utils::cancellation;
+
+using error::DracErrorCode;
+
+using threading::Spawn;
+using threading::Task;
+
+using types::i32;
+using types::Result;
+using types::Unit;
+
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+TEST(CancellationTest, NoScopeNeverStops) {
+  EXPECT_EQ(CancellationScope::current(), nullptr);
+  EXPECT_TRUE(CheckCancelled().has_value());
+  EXPECT_FALSE(RemainingTime().has_value());
+  EXPECT_EQ(ClampTimeout(seconds(5)), milliseconds(5000));
+}
+
+TEST(CancellationTest, StopTokenCancels) {
+  std::stop_source source;
+
+  const CancellationScope scope(source.get_token());
+  EXPECT_FALSE(StopRequested());
+
+  source.request_stop();
+
+  Result<> result = CheckCancelled();
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code, DracErrorCode::Cancelled);
+}
+
+TEST(CancellationTest, PassedDeadlineTimesOut) {
+  const CancellationScope scope(Clock::now() - milliseconds(1));
+
+  Result<> result = CheckCancelled();
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code, DracErrorCode::Timeout);
+  EXPECT_EQ(RemainingTime(), milliseconds(0));
+}
+
+TEST(CancellationTest, NestedScopesCombine) {
+  std::stop_source outerSource;
+
+  const CancellationScope outer(Clock::now() + seconds(1), outerSource.get_token());
+
+  {
+    // A later inner deadline doesn't extend the outer one.
+    const CancellationScope inner(Clock::now() + seconds(60));
+
+    ASSERT_TRUE(RemainingTime().has_value());
+    EXPECT_LE(*RemainingTime(), milliseconds(1000));
+    EXPECT_EQ(ClampTimeout(seconds(30)), *RemainingTime());
+
+    outerSource.request_stop();
+    EXPECT_TRUE(StopRequested());
+  }
+
+  EXPECT_EQ(CancellationScope::current(), &outer);
+}
+
+TEST(CancellationTest, TaskCancelReachesTheScope) {
+  std::promise<Unit> started;
+  std::promise<Unit> release;
+  std::promise<bool> sawStop;
+
+  Task<bool> task = Spawn([&started, &sawStop, gate = release.get_future().share()]() -> Result<bool> {
+    started.set_value();
+    gate.wait();
+    sawStop.set_value(StopRequested());
+    return true;
+  });
+
+  started.get_future().wait();
+  task.cancel();
+  release.set_value();
+
+  EXPECT_TRUE(sawStop.get_future().get());
+
+  Result<bool> result = task.get();
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code, DracErrorCode::Cancelled);
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
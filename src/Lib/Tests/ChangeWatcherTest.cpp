@@ -0,0 +1,107 @@
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <future>
+#include <unistd.h>
+#include <utility>
+
+#include <Drac++/Services/ChangeWatcher.hpp>
+
+#include <Drac++/Utils/CacheManager.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::services::watcher;
+
+using cache::CacheManager;
+using cache::CachePolicy;
+
+using types::i32;
+using types::Result;
+using types::UniquePointer;
+using types::Unit;
+
+namespace fs = std::filesystem;
+using namespace std::chrono_literals;
+
+class ChangeWatcherTest : public Test {
+ protected:
+  // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+  fs::path m_testDir;
+  // NOLINTEND(*-non-private-member-variables-in-classes)
+
+  fn SetUp() -> Unit override {
+    m_testDir = fs::temp_directory_path() / std::format("draconis_watcher_test_{}", getpid());
+    fs::create_directories(m_testDir);
+  }
+
+  fn TearDown() -> Unit override {
+    fs::remove_all(m_testDir);
+  }
+};
+
+TEST_F(ChangeWatcherTest, InvalidatesKeysOfChangedFile) {
+  CacheManager cache;
+  cache.setGlobalPolicy(CachePolicy::inMemory());
+
+  i32        fetchCount = 0;
+  const auto fetcher    = [&fetchCount]() -> Result<i32> { return ++fetchCount; };
+
+  ASSERT_EQ(cache.getOrSet<i32>("watched_key", fetcher), 1);
+  ASSERT_EQ(cache.getOrSet<i32>("watched_key", fetcher), 1);
+
+  // Creating and writing the file may be reported in more than one batch; only the first one resolves the promise.
+  std::promise<Unit> changed;
+  bool               notified = false;
+
+  Result<UniquePointer<ChangeWatcher>> watcher = ChangeWatcher::start(
+    cache,
+    {
+      .onChange = [&changed, &notified](const Change change) {
+        if (change == Change::File && !std::exchange(notified, true))
+          changed.set_value();
+      },
+      .coalesce = 10ms,
+      .files    = { { m_testDir / "watched", { "watched_key" } } },
+    }
+  );
+
+  ASSERT_TRUE(watcher.has_value()) << watcher.error().message;
+
+  std::future<Unit> changedFuture = changed.get_future();
+
+  // Other files in the same directory don't count, even ones whose names start with the watched file's.
+  std::ofstream(m_testDir / "unrelated") << "ignored";
+  std::ofstream(m_testDir / "watched.allow") << "ignored";
+  std::ofstream(m_testDir / "watched-journal") << "ignored";
+
+  EXPECT_EQ(changedFuture.wait_for(200ms), std::future_status::timeout);
+  EXPECT_EQ(cache.getOrSet<i32>("watched_key", fetcher), 1);
+
+  std::ofstream(m_testDir / "watched") << "changed";
+
+  ASSERT_EQ(changedFuture.wait_for(5s), std::future_status::ready);
+
+  EXPECT_EQ(cache.getOrSet<i32>("watched_key", fetcher), 2);
+}
+
+TEST_F(ChangeWatcherTest, StopsPromptlyWhenDestroyed) {
+  CacheManager cache;
+
+  Result<UniquePointer<ChangeWatcher>> watcher = ChangeWatcher::start(cache, { .files = { { m_testDir / "watched", {} } } });
+  ASSERT_TRUE(watcher.has_value()) << watcher.error().message;
+
+  const auto start = std::chrono::steady_clock::now();
+  watcher->reset();
+
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
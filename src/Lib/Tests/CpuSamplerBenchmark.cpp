@@ -0,0 +1,121 @@
+/**
+ * @file CpuSamplerBenchmark.cpp
+ * @brief Per-sample cost of CpuSampler on a simulated 128-core host.
+ *
+ * Feeds CpuSampler::record() pre-generated /proc/stat contents shaped like a
+ * 128-core machine's (cpu lines, then a long intr line and the rest), so the
+ * scan and delta work is measured the same on any host. Reading the host's
+ * real /proc/stat with sample() is timed as well, for reference; that also
+ * includes the kernel formatting the file.
+ *
+ * Run with `meson test --benchmark` or execute the binary directly.
+ */
+
+#include <chrono>
+#include <format>
+#include <iterator>
+
+#include <Drac++/Services/CpuSampler.hpp>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Logging.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+using namespace draconis::utils;
+using namespace draconis::services::sampling;
+
+using types::f64;
+using types::i32;
+using types::Result;
+using types::String;
+using types::u64;
+using types::Unit;
+using types::usize;
+using types::Vec;
+
+using std::chrono::duration;
+using std::chrono::microseconds;
+using std::chrono::steady_clock;
+
+namespace {
+  constexpr usize        CORES      = 128;
+  constexpr usize        SNAPSHOTS  = 64;
+  constexpr usize        INTERRUPTS = 1024;
+  constexpr usize        ITERATIONS = 100'000;
+  constexpr microseconds BUDGET     = microseconds(50);
+
+  /**
+   * @brief /proc/stat as a 128-core host would show it after @p step ticks per core.
+   */
+  fn ProcStat(const u64 step) -> String {
+    String text;
+
+    const fn cpuLine = [&text, step](const String& name, const u64 scale) {
+      // Wide values, like a host that's been up for a while.
+      const u64 base = 100'000'000 + step;
+
+      std::format_to(std::back_inserter(text), "{} {} {} {} {} {} {} {} {} 0 0\n", name, (base + step * 3) * scale, step * scale, (base / 4 + step) * scale, (base * 8 + step * 6) * scale, step / 2 * scale, step / 4 * scale, step / 3 * scale, 0);
+    };
+
+    cpuLine("cpu ", CORES);
+
+    for (usize core = 0; core < CORES; ++core)
+      cpuLine(std::format("cpu{}", core), 1);
+
+    text += "intr 98765432109";
+
+    for (usize irq = 0; irq < INTERRUPTS; ++irq)
+      std::format_to(std::back_inserter(text), " {}", irq % 7 == 0 ? 123'456 + step : 0);
+
+    std::format_to(std::back_inserter(text), "\nctxt 9876543210\nbtime 1700000000\nprocesses 4242424\nprocs_running 3\nprocs_blocked 0\nsoftirq 1234567 0 1 2 3 4 5 6 7 8 9\n");
+
+    return text;
+  }
+
+  template <typename F>
+  fn MicrosecondsPer(const usize iterations, F&& body) -> f64 {
+    const steady_clock::time_point begin = steady_clock::now();
+
+    for (usize i = 0; i < iterations; ++i)
+      body(i);
+
+    return duration<f64, std::micro>(steady_clock::now() - begin).count() / static_cast<f64>(iterations);
+  }
+} // namespace
+
+fn main() -> i32 {
+  using logging::Println;
+
+  Result<CpuSampler> sampler = CpuSampler::create();
+
+  if (!sampler) {
+    Println("Can't create a CpuSampler: {}", sampler.error().message);
+    return 1;
+  }
+
+  Vec<String> snapshots;
+  snapshots.reserve(SNAPSHOTS);
+
+  for (usize step = 0; step < SNAPSHOTS; ++step)
+    snapshots.push_back(ProcStat(step * 10));
+
+  // Settle on the simulated core count before timing.
+  (void)sampler->record(snapshots.front());
+
+  const f64 simulated = MicrosecondsPer(ITERATIONS, [&](const usize i) -> Unit {
+    (void)sampler->record(snapshots[i % SNAPSHOTS]);
+  });
+
+  Println("CpuSampler benchmark ({} iterations)", ITERATIONS);
+  Println("{:<32} {:>8.2f}us  (budget {}us, {} bytes of /proc/stat)", std::format("record(), {} cores", CORES), simulated, BUDGET.count(), snapshots.front().size());
+
+  Result<CpuSampler> host = CpuSampler::create();
+
+  if (host && host->sample()) {
+    const f64 real = MicrosecondsPer(ITERATIONS / 10, [&](usize) -> Unit { (void)host->sample(); });
+
+    Println("{:<32} {:>8.2f}us", std::format("sample(), this host's {} cores", host->coreCount()), real);
+  }
+
+  return simulated < static_cast<f64>(BUDGET.count()) ? 0 : 1;
+}
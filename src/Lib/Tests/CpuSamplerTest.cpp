@@ -0,0 +1,144 @@
+#include <cmath>
+#include <format>
+
+#include <Drac++/Services/CpuSampler.hpp>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::services::sampling;
+
+using types::f32;
+using types::i32;
+using types::Option;
+using types::Result;
+using types::String;
+using types::StringView;
+using types::Unit;
+using types::Vec;
+
+class CpuSamplerTest : public Test {
+ protected:
+  // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+  Result<CpuSampler> m_sampler = CpuSampler::create();
+  // NOLINTEND(*-non-private-member-variables-in-classes)
+
+  fn SetUp() -> Unit override {
+    if (!m_sampler)
+      GTEST_SKIP() << m_sampler.error().message;
+  }
+};
+
+namespace {
+  /**
+   * @brief A cpu line with the given ticks in user, idle, iowait and steal.
+   */
+  fn Line(const StringView name, const i32 user, const i32 idle, const i32 iowait = 0, const i32 steal = 0) -> String {
+    return std::format("{} {} 0 0 {} {} 0 0 {} 0 0\n", name, user, idle, iowait, steal);
+  }
+} // namespace
+
+TEST_F(CpuSamplerTest, FirstSampleOnlySetsTheBaseline) {
+  ASSERT_TRUE(m_sampler->record(Line("cpu ", 100, 100)).has_value());
+
+  EXPECT_EQ(m_sampler->intervalCount(), 0U);
+  EXPECT_FALSE(m_sampler->aggregate().has_value());
+}
+
+TEST_F(CpuSamplerTest, ComputesFractionsFromDeltas) {
+  ASSERT_TRUE(m_sampler->record(Line("cpu ", 1000, 5000, 10, 0) + Line("cpu0", 500, 2500, 5, 0) + Line("cpu1", 500, 2500, 5, 0) + "intr 1 2 3\n").has_value());
+
+  // Over this interval cpu0 is fully busy, and cpu1 splits its time between idle, IO wait and steal.
+  ASSERT_TRUE(m_sampler->record(Line("cpu ", 1100, 5040, 50, 20) + Line("cpu0", 600, 2500, 5, 0) + Line("cpu1", 500, 2540, 45, 20) + "intr 1 2 3\n").has_value());
+
+  ASSERT_EQ(m_sampler->intervalCount(), 1U);
+
+  const Option<CpuLoad> cpu0 = m_sampler->core(0);
+  ASSERT_TRUE(cpu0.has_value());
+  EXPECT_FLOAT_EQ(cpu0->busy, 1.0F);
+  EXPECT_FLOAT_EQ(cpu0->idle, 0.0F);
+
+  const Option<CpuLoad> cpu1 = m_sampler->core(1);
+  ASSERT_TRUE(cpu1.has_value());
+  EXPECT_FLOAT_EQ(cpu1->busy, 0.0F);
+  EXPECT_FLOAT_EQ(cpu1->idle, 0.4F);
+  EXPECT_FLOAT_EQ(cpu1->iowait, 0.4F);
+  EXPECT_FLOAT_EQ(cpu1->steal, 0.2F);
+
+  const Option<CpuLoad> total = m_sampler->aggregate();
+  ASSERT_TRUE(total.has_value());
+  EXPECT_FLOAT_EQ(total->busy, 0.5F);
+  EXPECT_FLOAT_EQ(total->busy + total->idle + total->iowait + total->steal, 1.0F);
+}
+
+TEST_F(CpuSamplerTest, OfflineCoresHaveNoLoad) {
+  ASSERT_TRUE(m_sampler->record(Line("cpu ", 0, 0) + Line("cpu0", 0, 0) + Line("cpu3", 0, 0)).has_value());
+  ASSERT_TRUE(m_sampler->record(Line("cpu ", 10, 10) + Line("cpu0", 10, 0) + Line("cpu3", 0, 10)).has_value());
+
+  EXPECT_GE(m_sampler->coreCount(), 4U);
+  EXPECT_TRUE(m_sampler->core(0).has_value());
+  EXPECT_FALSE(m_sampler->core(1).has_value());
+  EXPECT_TRUE(m_sampler->core(3).has_value());
+
+  const Vec<f32> busy = m_sampler->series(CpuMetric::Busy, 2);
+  ASSERT_EQ(busy.size(), 1U);
+  EXPECT_TRUE(std::isnan(busy[0]));
+}
+
+TEST_F(CpuSamplerTest, MoreCoresThanConfiguredStartOver) {
+  const String name = std::format("cpu{}", m_sampler->coreCount() + 7);
+
+  ASSERT_TRUE(m_sampler->record(Line("cpu ", 0, 0)).has_value());
+  ASSERT_TRUE(m_sampler->record(Line("cpu ", 10, 10)).has_value());
+  ASSERT_EQ(m_sampler->intervalCount(), 1U);
+
+  ASSERT_TRUE(m_sampler->record(Line("cpu ", 20, 20) + Line(name, 5, 5)).has_value());
+
+  EXPECT_EQ(m_sampler->intervalCount(), 0U);
+  EXPECT_FALSE(m_sampler->aggregate().has_value());
+}
+
+TEST_F(CpuSamplerTest, HistoryIsOldestFirstAndBounded) {
+  i32 user = 0;
+  i32 idle = 0;
+
+  ASSERT_TRUE(m_sampler->record(Line("cpu ", user, idle)).has_value());
+
+  // Busy climbs by 1% per interval, for more intervals than the ring holds.
+  for (i32 interval = 1; interval <= static_cast<i32>(CpuSampler::HISTORY_SIZE) + 10; ++interval) {
+    user += interval;
+    idle += 100 - interval;
+
+    ASSERT_TRUE(m_sampler->record(Line("cpu ", user, idle)).has_value());
+  }
+
+  const Vec<f32> busy = m_sampler->series(CpuMetric::Busy);
+  ASSERT_EQ(busy.size(), CpuSampler::HISTORY_SIZE);
+
+  EXPECT_FLOAT_EQ(busy.front(), 0.11F);
+  EXPECT_FLOAT_EQ(busy.back(), 0.74F);
+  EXPECT_FLOAT_EQ(m_sampler->aggregate(1)->busy, 0.73F);
+}
+
+TEST_F(CpuSamplerTest, RejectsTextWithoutCpuLines) {
+  EXPECT_FALSE(m_sampler->record("intr 1 2 3\n").has_value());
+  EXPECT_FALSE(m_sampler->record(Line("cpu0", 1, 1)).has_value());
+}
+
+TEST_F(CpuSamplerTest, SamplesProcStat) {
+  ASSERT_TRUE(m_sampler->sample().has_value());
+
+  const Result<> second = m_sampler->sample();
+  ASSERT_TRUE(second.has_value()) << second.error().message;
+
+  EXPECT_EQ(m_sampler->intervalCount(), 1U);
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+#include <format>
+#include <unistd.h>
+
+#include <Drac++/Services/LiveMetrics.hpp>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::services::metrics;
+
+using error::DracErrorCode;
+
+using types::i32;
+using types::Result;
+using types::String;
+using types::StringView;
+using types::UniquePointer;
+using types::Unit;
+
+class LiveMetricsTest : public Test {
+ protected:
+  // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+  String m_segmentName;
+  // NOLINTEND(*-non-private-member-variables-in-classes)
+
+  fn SetUp() -> Unit override {
+    m_segmentName = std::format("/draconis++-test-{}", getpid());
+  }
+};
+
+TEST_F(LiveMetricsTest, OpenWithoutPublisherIsNotFound) {
+  Result<UniquePointer<Reader>> reader = Reader::open(m_segmentName);
+
+  ASSERT_FALSE(reader.has_value());
+  EXPECT_EQ(reader.error().code, DracErrorCode::NotFound);
+}
+
+TEST_F(LiveMetricsTest, ReadsWhatWasPublished) {
+  Result<UniquePointer<Publisher>> publisher = Publisher::create(m_segmentName);
+  ASSERT_TRUE(publisher.has_value());
+
+  Result<UniquePointer<Reader>> reader = Reader::open(m_segmentName);
+  ASSERT_TRUE(reader.has_value());
+
+  Result<Snapshot> empty = (*reader)->read();
+  ASSERT_FALSE(empty.has_value());
+  EXPECT_EQ(empty.error().code, DracErrorCode::NotFound);
+
+  Snapshot snapshot;
+  snapshot.memUsedBytes  = 1024;
+  snapshot.memTotalBytes = 4096;
+  snapshot.uptimeSeconds = 42;
+  snapshot.valid         = Snapshot::MEMORY | Snapshot::UPTIME;
+
+  for (i32 i = 0; i < 3; ++i) {
+    snapshot.uptimeSeconds = 42 + i;
+    (*publisher)->publish(snapshot);
+  }
+
+  Result<Snapshot> read = (*reader)->read();
+  ASSERT_TRUE(read.has_value());
+
+  EXPECT_TRUE(read->has(Snapshot::MEMORY));
+  EXPECT_TRUE(read->has(Snapshot::UPTIME));
+  EXPECT_FALSE(read->has(Snapshot::BATTERY));
+  EXPECT_EQ(read->memUsedBytes, 1024U);
+  EXPECT_EQ(read->memTotalBytes, 4096U);
+  EXPECT_EQ(read->uptimeSeconds, 44);
+}
+
+TEST_F(LiveMetricsTest, SegmentIsRemovedWithPublisher) {
+  {
+    Result<UniquePointer<Publisher>> publisher = Publisher::create(m_segmentName);
+    ASSERT_TRUE(publisher.has_value());
+  }
+
+  EXPECT_FALSE(Reader::open(m_segmentName).has_value());
+}
+
+// macOS can't lock shared memory objects, so it doesn't enforce a single publisher.
+#ifndef __APPLE__
+TEST_F(LiveMetricsTest, SecondPublisherIsRefused) {
+  Result<UniquePointer<Publisher>> first = Publisher::create(m_segmentName);
+  ASSERT_TRUE(first.has_value()) << first.error().message;
+
+  Snapshot snapshot;
+  snapshot.valid         = Snapshot::UPTIME;
+  snapshot.uptimeSeconds = 7;
+  (*first)->publish(snapshot);
+
+  const Result<UniquePointer<Publisher>> second = Publisher::create(m_segmentName);
+  ASSERT_FALSE(second.has_value());
+  EXPECT_EQ(second.error().code, DracErrorCode::ConfigurationError);
+
+  // The refused publisher left the live segment alone.
+  Result<UniquePointer<Reader>> reader = Reader::open(m_segmentName);
+  ASSERT_TRUE(reader.has_value());
+  EXPECT_EQ((*reader)->read()->uptimeSeconds, 7);
+
+  first->reset();
+
+  EXPECT_TRUE(Publisher::create(m_segmentName).has_value());
+}
+#endif
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
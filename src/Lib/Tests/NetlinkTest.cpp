@@ -0,0 +1,198 @@
+#include <cstring>
+#include <linux/if_link.h>
+#include <linux/rtnetlink.h>
+#include <net/if.h>
+#include <sys/socket.h>
+
+#include <Drac++/Utils/Types.hpp>
+
+#include "OS/Linux/Netlink.hpp"
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::core::system::linux;
+
+using types::Array;
+using types::i32;
+using types::Option;
+using types::Result;
+using types::String;
+using types::StringView;
+using types::u16;
+using types::u32;
+using types::u64;
+using types::u8;
+using types::Unit;
+using types::usize;
+using types::Vec;
+
+namespace {
+  /**
+   * @brief Builds a message payload the way the kernel lays it out: a family header, then aligned attributes.
+   */
+  class PayloadBuilder {
+   public:
+    template <typename T>
+    explicit PayloadBuilder(const T& header) {
+      append(&header, sizeof(T));
+    }
+
+    template <typename T>
+    fn attribute(const u16 type, const T& value) -> PayloadBuilder& {
+      return attribute(type, &value, sizeof(T));
+    }
+
+    fn attribute(const u16 type, const StringView text) -> PayloadBuilder& {
+      const String terminated(text);
+      return attribute(type, terminated.c_str(), terminated.size() + 1);
+    }
+
+    fn attribute(const u16 type, const void* data, const usize size) -> PayloadBuilder& {
+      const rtattr header { .rta_len = static_cast<u16>(RTA_LENGTH(size)), .rta_type = type };
+
+      append(&header, sizeof(header));
+      append(data, size);
+
+      return *this;
+    }
+
+    [[nodiscard]] fn message(const u16 type) const -> netlink::Message {
+      return { .type = type, .payload = { m_bytes.data(), m_bytes.size() } };
+    }
+
+   private:
+    fn append(const void* data, const usize size) -> Unit {
+      const usize offset = m_bytes.size();
+
+      m_bytes.resize(offset + RTA_ALIGN(size));
+      std::memcpy(m_bytes.data() + offset, data, size);
+    }
+
+    Vec<char> m_bytes;
+  };
+} // namespace
+
+TEST(NetlinkTest, ParsesLinks) {
+  rtnl_link_stats64 stats {};
+  stats.rx_bytes = 1ULL << 40U;
+  stats.tx_bytes = 12345;
+
+  ifinfomsg info {};
+  info.ifi_index = 4;
+  info.ifi_flags = IFF_UP | IFF_RUNNING;
+
+  const u32          mtu = 1500;
+  const Array<u8, 6> mac = { 0x02, 0xfc, 0x00, 0x00, 0x00, 0x01 };
+
+  PayloadBuilder builder(info);
+  builder.attribute(IFLA_IFNAME, "eth0").attribute(IFLA_MTU, mtu).attribute(IFLA_ADDRESS, mac).attribute(IFLA_STATS64, stats);
+
+  const Option<netlink::Link> link = netlink::ParseLink(builder.message(RTM_NEWLINK));
+  ASSERT_TRUE(link.has_value());
+
+  EXPECT_EQ(link->index, 4);
+  EXPECT_EQ(link->name, "eth0");
+  EXPECT_EQ(link->flags, static_cast<u32>(IFF_UP | IFF_RUNNING));
+  EXPECT_EQ(link->mtu, 1500U);
+  EXPECT_EQ(link->hardwareAddress.size(), mac.size());
+  EXPECT_EQ(link->rxBytes, 1ULL << 40U);
+  EXPECT_EQ(link->txBytes, 12345U);
+
+  EXPECT_FALSE(netlink::ParseLink(builder.message(RTM_NEWADDR)).has_value());
+}
+
+TEST(NetlinkTest, ShortStatsFromOlderKernelsStillParse) {
+  // Only rx/tx packets and bytes, as if the struct were truncated.
+  const Array<u64, 4> stats = { 10, 20, 30, 40 };
+
+  PayloadBuilder builder(ifinfomsg {});
+  builder.attribute(IFLA_IFNAME, "lo").attribute(IFLA_STATS64, stats);
+
+  const Option<netlink::Link> link = netlink::ParseLink(builder.message(RTM_NEWLINK));
+  ASSERT_TRUE(link.has_value());
+
+  EXPECT_EQ(link->rxPackets, 10U);
+  EXPECT_EQ(link->txPackets, 20U);
+  EXPECT_EQ(link->rxBytes, 30U);
+  EXPECT_EQ(link->txBytes, 40U);
+  EXPECT_FALSE(link->mtu.has_value());
+}
+
+TEST(NetlinkTest, PrefersLocalAddressOverPeer) {
+  const Array<u8, 4> peer  = { 10, 0, 0, 1 };
+  const Array<u8, 4> local = { 10, 0, 0, 2 };
+
+  PayloadBuilder builder(ifaddrmsg { .ifa_family = AF_INET, .ifa_prefixlen = 32, .ifa_flags = 0, .ifa_scope = RT_SCOPE_UNIVERSE, .ifa_index = 7 });
+  builder.attribute(IFA_ADDRESS, peer).attribute(IFA_LOCAL, local);
+
+  const Option<netlink::Address> address = netlink::ParseAddress(builder.message(RTM_NEWADDR));
+  ASSERT_TRUE(address.has_value());
+
+  EXPECT_EQ(address->index, 7);
+  EXPECT_EQ(address->family, AF_INET);
+  ASSERT_EQ(address->address.size(), local.size());
+  EXPECT_EQ(static_cast<u8>(address->address[3]), 2);
+}
+
+TEST(NetlinkTest, OnlyMainTableDefaultRoutesCount) {
+  const fn route = [](const u8 dstLength, const u8 table, const i32 outputIndex) {
+    PayloadBuilder builder(rtmsg {
+      .rtm_family   = AF_INET,
+      .rtm_dst_len  = dstLength,
+      .rtm_src_len  = 0,
+      .rtm_tos      = 0,
+      .rtm_table    = table,
+      .rtm_protocol = RTPROT_BOOT,
+      .rtm_scope    = RT_SCOPE_UNIVERSE,
+      .rtm_type     = RTN_UNICAST,
+      .rtm_flags    = 0,
+    });
+    builder.attribute(RTA_OIF, outputIndex).attribute(RTA_PRIORITY, u32 { 100 });
+
+    return netlink::ParseDefaultRoute(builder.message(RTM_NEWROUTE));
+  };
+
+  const Option<netlink::Route> defaultRoute = route(0, RT_TABLE_MAIN, 3);
+  ASSERT_TRUE(defaultRoute.has_value());
+  EXPECT_EQ(defaultRoute->outputIndex, 3);
+  EXPECT_EQ(defaultRoute->priority, 100U);
+
+  EXPECT_FALSE(route(24, RT_TABLE_MAIN, 3).has_value());
+  EXPECT_FALSE(route(0, RT_TABLE_LOCAL, 3).has_value());
+}
+
+TEST(NetlinkTest, TruncatedAttributesAreIgnored) {
+  PayloadBuilder builder(ifinfomsg {});
+  builder.attribute(IFLA_IFNAME, "wlan0");
+
+  netlink::Message message = builder.message(RTM_NEWLINK);
+
+  // Cut into the middle of the name attribute; it must be skipped rather than read past the end.
+  message.payload = message.payload.first(message.payload.size() - 4);
+
+  EXPECT_FALSE(netlink::ParseLink(message).has_value());
+}
+
+TEST(NetlinkTest, DumpsLinksFromTheKernel) {
+  Result<netlink::Socket> socket = netlink::Socket::open();
+
+  if (!socket)
+    GTEST_SKIP() << socket.error().message;
+
+  netlink::ReceiveBuffer buffer;
+  bool                   sawLoopback = false;
+
+  const Result<> done = socket->dump(RTM_GETLINK, AF_UNSPEC, buffer, [&sawLoopback](const netlink::Message& message) {
+    if (const Option<netlink::Link> link = netlink::ParseLink(message))
+      sawLoopback = sawLoopback || (link->flags & IFF_LOOPBACK) != 0;
+  });
+
+  ASSERT_TRUE(done.has_value()) << done.error().message;
+  EXPECT_TRUE(sawLoopback);
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
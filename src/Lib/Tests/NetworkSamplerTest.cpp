@@ -0,0 +1,139 @@
+#include <chrono>
+
+#include <Drac++/Services/NetworkSampler.hpp>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::services::sampling;
+
+using types::i32;
+using types::Result;
+using types::u64;
+using types::Unit;
+using types::Vec;
+
+using std::chrono::steady_clock;
+using namespace std::chrono_literals;
+
+namespace {
+  fn Counters(const u64 rxBytes, const u64 txBytes) -> InterfaceCounters {
+    return { .rxBytes = rxBytes, .txBytes = txBytes, .rxPackets = rxBytes / 100, .txPackets = txBytes / 100 };
+  }
+} // namespace
+
+class NetworkSamplerTest : public Test {
+ protected:
+  // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+  Result<NetworkSampler>   m_sampler = NetworkSampler::create();
+  steady_clock::time_point m_start   = steady_clock::now();
+  // NOLINTEND(*-non-private-member-variables-in-classes)
+
+  fn SetUp() -> Unit override {
+    if (!m_sampler)
+      GTEST_SKIP() << m_sampler.error().message;
+  }
+};
+
+TEST_F(NetworkSamplerTest, NoRateUntilSampledTwice) {
+  m_sampler->record("eth0", Counters(1000, 500), m_start);
+
+  const Result<InterfaceThroughput> eth0 = m_sampler->throughput("eth0");
+  ASSERT_TRUE(eth0.has_value());
+
+  EXPECT_EQ(eth0->totals.rxBytes, 1000U);
+  EXPECT_FALSE(eth0->perSecond.has_value());
+
+  EXPECT_FALSE(m_sampler->throughput("wlan0").has_value());
+}
+
+TEST_F(NetworkSamplerTest, RatesAreDeltasOverTime) {
+  m_sampler->record("eth0", Counters(0, 0), m_start);
+  m_sampler->record("eth0", Counters(100'000, 20'000), m_start + 500ms);
+
+  const Result<InterfaceThroughput> eth0 = m_sampler->throughput("eth0");
+  ASSERT_TRUE(eth0.has_value() && eth0->perSecond.has_value());
+
+  EXPECT_DOUBLE_EQ(eth0->perSecond->rxBytes, 200'000);
+  EXPECT_DOUBLE_EQ(eth0->perSecond->txBytes, 40'000);
+  EXPECT_DOUBLE_EQ(eth0->perSecond->rxPackets, 2'000);
+  EXPECT_DOUBLE_EQ(eth0->perSecond->txPackets, 400);
+}
+
+TEST_F(NetworkSamplerTest, RatesAreSmoothedOverTheWindow) {
+  // A burst of 1 MB in the first 100 ms, then nothing for 900 ms.
+  m_sampler->record("eth0", Counters(0, 0), m_start);
+  m_sampler->record("eth0", Counters(1'000'000, 0), m_start + 100ms);
+
+  for (i32 tick = 2; tick <= 10; ++tick)
+    m_sampler->record("eth0", Counters(1'000'000, 0), m_start + (tick * 100ms));
+
+  EXPECT_DOUBLE_EQ(m_sampler->throughput("eth0", 1s)->perSecond->rxBytes, 1'000'000);
+
+  // A shorter window only sees the idle part.
+  EXPECT_DOUBLE_EQ(m_sampler->throughput("eth0", 300ms)->perSecond->rxBytes, 0);
+}
+
+TEST_F(NetworkSamplerTest, WindowShorterThanSampleIntervalUsesPreviousSample) {
+  m_sampler->record("eth0", Counters(0, 0), m_start);
+  m_sampler->record("eth0", Counters(2'000, 0), m_start + 2s);
+
+  EXPECT_DOUBLE_EQ(m_sampler->throughput("eth0", 100ms)->perSecond->rxBytes, 1'000);
+}
+
+TEST_F(NetworkSamplerTest, OldSamplesFallOutOfTheRing) {
+  // Twice as many samples as the ring holds, 10 bytes per second throughout.
+  for (u64 tick = 0; tick < 2 * NetworkSampler::HISTORY_SIZE; ++tick)
+    m_sampler->record("eth0", Counters(tick * 10, 0), m_start + (tick * 1s));
+
+  EXPECT_DOUBLE_EQ(m_sampler->throughput("eth0", 1h)->perSecond->rxBytes, 10);
+}
+
+TEST_F(NetworkSamplerTest, CounterResetStartsOver) {
+  m_sampler->record("eth0", Counters(5'000'000, 5'000'000), m_start);
+  m_sampler->record("eth0", Counters(6'000'000, 6'000'000), m_start + 1s);
+
+  // The interface was recreated, so its counters restart near zero.
+  m_sampler->record("eth0", Counters(100, 100), m_start + 2s);
+
+  const Result<InterfaceThroughput> eth0 = m_sampler->throughput("eth0");
+  ASSERT_TRUE(eth0.has_value());
+
+  EXPECT_EQ(eth0->totals.rxBytes, 100U);
+  EXPECT_FALSE(eth0->perSecond.has_value());
+}
+
+TEST_F(NetworkSamplerTest, ListsInterfacesByName) {
+  m_sampler->record("wlan0", Counters(0, 0), m_start);
+  m_sampler->record("eth0", Counters(0, 0), m_start);
+
+  const Vec<InterfaceThroughput> interfaces = m_sampler->throughput();
+  ASSERT_EQ(interfaces.size(), 2U);
+
+  EXPECT_EQ(interfaces[0].name, "eth0");
+  EXPECT_EQ(interfaces[1].name, "wlan0");
+}
+
+TEST_F(NetworkSamplerTest, SamplesTheLoopbackInterface) {
+  const Result<> first = m_sampler->sample();
+  ASSERT_TRUE(first.has_value()) << first.error().message;
+
+  // Recorded interfaces that the system doesn't have are forgotten by the next real sample.
+  m_sampler->record("not-a-real-interface", Counters(0, 0), m_start);
+  ASSERT_TRUE(m_sampler->sample().has_value());
+
+  EXPECT_FALSE(m_sampler->throughput("not-a-real-interface").has_value());
+
+  const Result<InterfaceThroughput> loopback = m_sampler->throughput("lo");
+  ASSERT_TRUE(loopback.has_value()) << loopback.error().message;
+  EXPECT_TRUE(loopback->perSecond.has_value());
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,167 @@
+#include <format>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "OS/PciIds.hpp"
+#include "OS/PciTable.hpp"
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::core::system;
+
+using error::DracErrorCode;
+
+using types::i32;
+using types::Pair;
+using types::Result;
+using types::String;
+using types::StringView;
+using types::u16;
+using types::u32;
+using types::Vec;
+
+namespace {
+  // Trimmed-down pci.ids with the same shape as the real one, out of order on purpose.
+  constexpr StringView PCI_IDS = "# List of PCI ID's\n"
+                                 "#\n"
+                                 "8086  Intel Corporation\n"
+                                 "\t56a0  DG2 [Arc A770]\n"
+                                 "\t0412  Xeon E3-1200 v3/4th Gen Core Processor Integrated Graphics Controller\n"
+                                 "\t\t1028 05d7  Alienware X51 R2\n"
+                                 "1002  Advanced Micro Devices, Inc. [AMD/ATI]\n"
+                                 "\t744c  Navi 31 [Radeon RX 7900 XT/7900 XTX/7900M]\n"
+                                 "10de  NVIDIA Corporation\n"
+                                 "\t2684  AD102 [GeForce RTX 4090]\n"
+                                 "\n"
+                                 "# List of known device classes, subclasses and programming interfaces\n"
+                                 "C 03  Display controller\n"
+                                 "\t00  VGA compatible controller\n";
+} // namespace
+
+TEST(PciIdsTest, FindsVendorAndDevice) {
+  Result<String> index = pci::BuildIndex(PCI_IDS);
+  ASSERT_TRUE(index.has_value());
+
+  Result<Pair<StringView, StringView>> names = pci::Lookup(*index, 0x10de, 0x2684);
+  ASSERT_TRUE(names.has_value());
+  EXPECT_EQ(names->first, "NVIDIA Corporation");
+  EXPECT_EQ(names->second, "AD102 [GeForce RTX 4090]");
+
+  names = pci::Lookup(*index, 0x8086, 0x0412);
+  ASSERT_TRUE(names.has_value());
+  EXPECT_EQ(names->first, "Intel Corporation");
+  EXPECT_EQ(names->second, "Xeon E3-1200 v3/4th Gen Core Processor Integrated Graphics Controller");
+}
+
+TEST(PciIdsTest, UnknownIdsAreNotFound) {
+  Result<String> index = pci::BuildIndex(PCI_IDS);
+  ASSERT_TRUE(index.has_value());
+
+  // Subsystem and class lines must not be indexed as devices.
+  for (const auto& [vendor, device] : { Pair(0x1234, 0x0001), Pair(0x8086, 0x1028), Pair(0x1002, 0x0000) }) {
+    Result<Pair<StringView, StringView>> names = pci::Lookup(*index, vendor, device);
+    ASSERT_FALSE(names.has_value());
+    EXPECT_EQ(names.error().code, DracErrorCode::NotFound);
+  }
+}
+
+TEST(PciIdsTest, RejectsGarbage) {
+  EXPECT_FALSE(pci::BuildIndex("# nothing here\n").has_value());
+
+  Result<Pair<StringView, StringView>> names = pci::Lookup("not an index at all, just some text", 0x10de, 0x2684);
+  ASSERT_FALSE(names.has_value());
+  EXPECT_EQ(names.error().code, DracErrorCode::CorruptedData);
+}
+
+TEST(PciIdsTest, ParsesSysfsAndPciIdsSpellings) {
+  EXPECT_EQ(pci::ParseId("0x10de"), 0x10de);
+  EXPECT_EQ(pci::ParseId("10DE"), 0x10de);
+  EXPECT_FALSE(pci::ParseId("0x").has_value());
+  EXPECT_FALSE(pci::ParseId("0x10000").has_value());
+  EXPECT_FALSE(pci::ParseId("10de ").has_value());
+}
+
+TEST(PciIdsTest, LinkedTableFindsEveryDevice) {
+  const Vec<pci::DeviceName> devices = pci::ParseDevices(PCI_IDS);
+  ASSERT_EQ(devices.size(), 4U);
+
+  Result<pci::Table> table = pci::BuildTable(devices);
+  ASSERT_TRUE(table.has_value()) << table.error().message;
+
+  for (const pci::DeviceName& device : devices) {
+    Result<Pair<StringView, StringView>> names = pci::LookupLinked(table->view(), device.vendorId, device.deviceId);
+    ASSERT_TRUE(names.has_value()) << names.error().message;
+    EXPECT_EQ(names->first, device.vendor);
+    EXPECT_EQ(names->second, device.device);
+  }
+}
+
+TEST(PciIdsTest, LinkedTableMissesLandOnOtherSlots) {
+  Result<pci::Table> table = pci::BuildTable(pci::ParseDevices(PCI_IDS));
+  ASSERT_TRUE(table.has_value());
+
+  for (const auto& [vendor, device] : { Pair<u16, u16>(0x1234, 0x0001), Pair<u16, u16>(0x8086, 0x1028), Pair<u16, u16>(0x10de, 0x2685) }) {
+    // Whatever slot a miss hashes to is either empty or holds a different key.
+    const u32              key  = (static_cast<u32>(vendor) << 16U) | device;
+    const u32              seed = table->seeds[pci::HashId(key, 0) % table->seeds.size()];
+    const pci::LinkedSlot& slot = table->slots[pci::HashId(key, seed) % table->slots.size()];
+
+    EXPECT_TRUE(slot.vendor == pci::LinkedSlot::EMPTY_SLOT || slot.key != key);
+
+    Result<Pair<StringView, StringView>> names = pci::LookupLinked(table->view(), vendor, device);
+    ASSERT_FALSE(names.has_value());
+    EXPECT_EQ(names.error().code, DracErrorCode::NotFound);
+  }
+
+  EXPECT_FALSE(pci::LookupLinked({}, 0x10de, 0x2684).has_value());
+}
+
+TEST(PciIdsTest, DisplayOnlyKeepsDisplayVendors) {
+  Vec<pci::DeviceName> devices = pci::ParseDevices("1af4  Red Hat, Inc.\n"
+                                                   "\t1050  Virtio 1.0 GPU\n"
+                                                   "1b21  ASMedia Technology Inc.\n"
+                                                   "\t1242  ASM1142 USB 3.1 Host Controller\n"
+                                                   "10de  NVIDIA Corporation\n"
+                                                   "\t2684  AD102 [GeForce RTX 4090]\n");
+
+  pci::KeepDisplayVendors(devices);
+
+  ASSERT_EQ(devices.size(), 2U);
+  EXPECT_EQ(devices[0].vendorId, 0x1af4);
+  EXPECT_EQ(devices[1].vendorId, 0x10de);
+
+  Result<pci::Table> table = pci::BuildTable(devices);
+  ASSERT_TRUE(table.has_value());
+
+  EXPECT_TRUE(pci::LookupLinked(table->view(), 0x10de, 0x2684).has_value());
+  EXPECT_FALSE(pci::LookupLinked(table->view(), 0x1b21, 0x1242).has_value());
+}
+
+TEST(PciIdsTest, LinkedTableRejectsEmptyInput) {
+  Result<pci::Table> table = pci::BuildTable({});
+  ASSERT_FALSE(table.has_value());
+  EXPECT_EQ(table.error().code, DracErrorCode::ParseError);
+}
+
+TEST(PciIdsTest, RendersTableAsHeader) {
+  Result<pci::Table> table = pci::BuildTable(pci::ParseDevices("10de  \"Quoted\" Vendor\n\t2684  Device\n"));
+  ASSERT_TRUE(table.has_value());
+
+  const String header = pci::RenderTable(*table, "pci.ids");
+
+  EXPECT_TRUE(header.starts_with("// Generated by pci-table-gen from pci.ids."));
+  EXPECT_TRUE(header.contains(std::format("Array<u32, {}> SEEDS", table->seeds.size())));
+  EXPECT_TRUE(header.contains(std::format("Array<LinkedSlot, {}> SLOTS", table->slots.size())));
+  EXPECT_TRUE(header.contains("Array<LinkedVendor, 1> VENDORS"));
+
+  // Quotes in names are escaped as octal, so the literal stays intact.
+  EXPECT_TRUE(header.contains("\\042Quoted\\042 Vendor"));
+  EXPECT_TRUE(header.contains(std::format("static_assert(NAMES.size() == {});", table->names.size())));
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
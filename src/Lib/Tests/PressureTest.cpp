@@ -0,0 +1,166 @@
+#include <chrono>
+#include <filesystem>
+#include <stop_token>
+#include <thread>
+
+#include <Drac++/Services/Pressure.hpp>
+
+#include <Drac++/Utils/Cancellation.hpp>
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::services::pressure;
+
+using cancellation::CancellationScope;
+using error::DracErrorCode;
+
+using types::i32;
+using types::Result;
+using types::Vec;
+
+using std::chrono::steady_clock;
+using namespace std::chrono_literals;
+
+TEST(PressureTest, ParsesSomeAndFullLines) {
+  const Result<Pressure> pressure = ParsePressure(
+    "some avg10=0.52 avg60=0.91 avg300=0.78 total=40416976\n"
+    "full avg10=1.50 avg60=0.00 avg300=0.00 total=1592691\n"
+  );
+
+  ASSERT_TRUE(pressure.has_value()) << pressure.error().message;
+
+  EXPECT_DOUBLE_EQ(pressure->some.avg10, 0.52);
+  EXPECT_DOUBLE_EQ(pressure->some.avg60, 0.91);
+  EXPECT_DOUBLE_EQ(pressure->some.avg300, 0.78);
+  EXPECT_EQ(pressure->some.total, 40416976us);
+
+  ASSERT_TRUE(pressure->full.has_value());
+  EXPECT_DOUBLE_EQ(pressure->full->avg10, 1.5);
+  EXPECT_EQ(pressure->full->total, 1592691us);
+}
+
+TEST(PressureTest, FullLineIsOptional) {
+  // System-wide CPU pressure on kernels before 5.13.
+  const Result<Pressure> pressure = ParsePressure("some avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+
+  ASSERT_TRUE(pressure.has_value());
+  EXPECT_FALSE(pressure->full.has_value());
+}
+
+TEST(PressureTest, RejectsMalformedContents) {
+  EXPECT_FALSE(ParsePressure("").has_value());
+  EXPECT_FALSE(ParsePressure("some avg10=abc avg60=0.00 avg300=0.00 total=0\n").has_value());
+  EXPECT_FALSE(ParsePressure("some avg10=0.00 avg60=0.00 total=0\n").has_value());
+}
+
+TEST(PressureTest, ReadsSystemPressure) {
+  const Result<Pressure> memory = GetPressure(Resource::Memory);
+
+  if (!memory && memory.error().code == DracErrorCode::UnavailableFeature)
+    GTEST_SKIP() << memory.error().message;
+
+  ASSERT_TRUE(memory.has_value()) << memory.error().message;
+  EXPECT_TRUE(memory->full.has_value());
+}
+
+TEST(PressureTest, ReadsOwnCgroupPressure) {
+  const Result<std::filesystem::path> cgroup = GetCurrentCgroup();
+
+  if (!cgroup)
+    GTEST_SKIP() << cgroup.error().message;
+
+  const Result<Pressure> cpu = GetCgroupPressure(Resource::Cpu, *cgroup);
+
+  // The root cgroup has no pressure files of its own, and PSI may be off.
+  if (!cpu && cpu.error().code == DracErrorCode::UnavailableFeature)
+    GTEST_SKIP() << cpu.error().message;
+
+  ASSERT_TRUE(cpu.has_value()) << cpu.error().message;
+  EXPECT_GE(cpu->some.avg10, 0.0);
+
+  EXPECT_FALSE(GetCgroupPressure(Resource::Cpu, *cgroup / "no-such-cgroup").has_value());
+}
+
+TEST(PressureTest, RejectsOutOfRangeTriggers) {
+  Result<PressureMonitor> monitor = PressureMonitor::create();
+  ASSERT_TRUE(monitor.has_value()) << monitor.error().message;
+
+  const Result<TriggerId> shortWindow = monitor->subscribe({ .resource = Resource::Memory, .threshold = 10ms, .window = 100ms });
+  ASSERT_FALSE(shortWindow.has_value());
+  EXPECT_EQ(shortWindow.error().code, DracErrorCode::InvalidArgument);
+
+  const Result<TriggerId> longThreshold = monitor->subscribe({ .resource = Resource::Memory, .threshold = 3s, .window = 2s });
+  ASSERT_FALSE(longThreshold.has_value());
+  EXPECT_EQ(longThreshold.error().code, DracErrorCode::InvalidArgument);
+
+  EXPECT_FALSE(monitor->unsubscribe(42).has_value());
+}
+
+TEST(PressureTest, WaitTimesOutWithoutEvents) {
+  Result<PressureMonitor> monitor = PressureMonitor::create();
+  ASSERT_TRUE(monitor.has_value());
+
+  const Result<Vec<TriggerEvent>> events = monitor->wait(20ms);
+
+  ASSERT_TRUE(events.has_value()) << events.error().message;
+  EXPECT_TRUE(events->empty());
+}
+
+TEST(PressureTest, WakeEndsWaitFromAnotherThread) {
+  Result<PressureMonitor> monitor = PressureMonitor::create();
+  ASSERT_TRUE(monitor.has_value());
+
+  const std::jthread waker([&monitor] {
+    std::this_thread::sleep_for(20ms);
+    monitor->wake();
+  });
+
+  const steady_clock::time_point  start  = steady_clock::now();
+  const Result<Vec<TriggerEvent>> events = monitor->wait();
+
+  ASSERT_TRUE(events.has_value());
+  EXPECT_TRUE(events->empty());
+  EXPECT_LT(steady_clock::now() - start, 5s);
+}
+
+TEST(PressureTest, StopTokenCancelsWait) {
+  Result<PressureMonitor> monitor = PressureMonitor::create();
+  ASSERT_TRUE(monitor.has_value());
+
+  std::stop_source stop;
+
+  const std::jthread stopper([&stop] {
+    std::this_thread::sleep_for(20ms);
+    stop.request_stop();
+  });
+
+  const CancellationScope scope(stop.get_token());
+
+  const Result<Vec<TriggerEvent>> events = monitor->wait();
+
+  ASSERT_FALSE(events.has_value());
+  EXPECT_EQ(events.error().code, DracErrorCode::Cancelled);
+}
+
+TEST(PressureTest, SubscribesToMemoryPressure) {
+  Result<PressureMonitor> monitor = PressureMonitor::create();
+  ASSERT_TRUE(monitor.has_value());
+
+  const Result<TriggerId> trigger = monitor->subscribe({ .resource = Resource::Memory, .threshold = 150ms, .window = 2s });
+
+  // Needs PSI, and either root or a 6.5+ kernel.
+  if (!trigger)
+    GTEST_SKIP() << trigger.error().message;
+
+  EXPECT_TRUE(monitor->unsubscribe(*trigger).has_value());
+  EXPECT_FALSE(monitor->unsubscribe(*trigger).has_value());
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
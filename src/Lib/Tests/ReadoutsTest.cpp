@@ -0,0 +1,149 @@
+#include <format>
+#include <memory>
+
+#include <Drac++/Core/System.hpp>
+
+#include <Drac++/Utils/CacheManager.hpp>
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "OS/Readouts.hpp"
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::core::system;
+
+using cache::CacheManager;
+using cache::CachePolicy;
+using detail::SharedSource;
+using error::DracError;
+using error::DracErrorCode;
+
+using types::Err;
+using types::i32;
+using types::Result;
+using types::SharedPointer;
+using types::String;
+using types::u32;
+using types::Unit;
+
+namespace {
+  /**
+   * @brief A source that counts its reads and returns the count as its value.
+   */
+  struct CountingSource {
+    u32 reads = 0;
+
+    fn operator()() -> Result<String> {
+      return std::format("read {}", ++reads);
+    }
+  };
+
+  /**
+   * @brief A shared source over @p counter, the way CollectSharedSources() builds them.
+   */
+  fn MakeShared(CountingSource& counter) -> SharedPointer<SharedSource<String>> {
+    return std::make_shared<SharedSource<String>>([&counter] { return counter(); });
+  }
+} // namespace
+
+class ReadoutsTest : public Test {
+ protected:
+  // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+  CacheManager   m_cache;
+  CountingSource m_counter;
+  // NOLINTEND(*-non-private-member-variables-in-classes)
+
+  fn SetUp() -> Unit override {
+    m_cache.setGlobalPolicy(CachePolicy::inMemory());
+  }
+
+  /**
+   * @brief A cached readout derived from @p source, like the platform's GetXFrom() helpers.
+   */
+  fn readout(const String& key, const SharedPointer<SharedSource<String>>& source) -> Result<String> {
+    return m_cache.getOrSet<String>(key, [source]() -> Result<String> { return source->get(); });
+  }
+};
+
+TEST_F(ReadoutsTest, SourceIsReadOnceWhileOpen) {
+  const SharedPointer<SharedSource<String>> source = MakeShared(m_counter);
+
+  EXPECT_EQ(source->get(), "read 1");
+  EXPECT_EQ(source->get(), "read 1");
+  EXPECT_EQ(m_counter.reads, 1U);
+}
+
+TEST_F(ReadoutsTest, FailedReadIsSharedToo) {
+  u32 reads = 0;
+
+  SharedSource<String> source([&reads]() -> Result<String> {
+    ++reads;
+    return Err(DracError(DracErrorCode::ApiUnavailable, "unavailable"));
+  });
+
+  EXPECT_FALSE(source.get().has_value());
+  EXPECT_EQ(source.get().error().code, DracErrorCode::ApiUnavailable);
+  EXPECT_EQ(reads, 1U);
+}
+
+TEST_F(ReadoutsTest, ReadoutsInOneCollectionShareARead) {
+  const SharedPointer<SharedSource<String>> source = MakeShared(m_counter);
+
+  EXPECT_EQ(readout("interfaces", source), "read 1");
+  EXPECT_EQ(readout("primary_interface", source), "read 1");
+
+  source->close();
+
+  EXPECT_EQ(m_counter.reads, 1U);
+}
+
+TEST_F(ReadoutsTest, CacheHitsNeverTouchTheSource) {
+  {
+    const SharedPointer<SharedSource<String>> first = MakeShared(m_counter);
+    ASSERT_TRUE(readout("interfaces", first).has_value());
+    first->close();
+  }
+
+  ASSERT_EQ(m_counter.reads, 1U);
+
+  const SharedPointer<SharedSource<String>> second = MakeShared(m_counter);
+
+  EXPECT_EQ(readout("interfaces", second), "read 1");
+  EXPECT_EQ(m_counter.reads, 1U);
+
+  second->close();
+}
+
+TEST_F(ReadoutsTest, CloseDropsTheSharedData) {
+  const SharedPointer<SharedSource<String>> source = MakeShared(m_counter);
+
+  EXPECT_EQ(source->get(), "read 1");
+
+  source->close();
+
+  // A fetcher that outlives the collection (a background refresh, say) reads afresh every time.
+  EXPECT_EQ(source->get(), "read 2");
+  EXPECT_EQ(source->get(), "read 3");
+  EXPECT_EQ(m_counter.reads, 3U);
+}
+
+TEST_F(ReadoutsTest, CollectsOnlyRequestedReadouts) {
+  using enum Readout;
+
+  const Readouts readouts = CollectReadouts(m_cache, MemInfo | Uptime);
+
+  EXPECT_TRUE(readouts.memInfo.has_value());
+  EXPECT_TRUE(readouts.uptime.has_value());
+
+  EXPECT_FALSE(readouts.kernelVersion.has_value());
+  EXPECT_FALSE(readouts.operatingSystem.has_value());
+  EXPECT_FALSE(readouts.networkInterfaces.has_value());
+  EXPECT_FALSE(readouts.battery.has_value());
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
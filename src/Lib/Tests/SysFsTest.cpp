@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <fstream>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "OS/Linux/SysFs.hpp"
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::core::system::linux::sysfs;
+
+using error::DracErrorCode;
+
+using types::i32;
+using types::PCStr;
+using types::Result;
+using types::String;
+using types::StringView;
+using types::u32;
+using types::Unit;
+using types::usize;
+using types::Vec;
+
+namespace fs = std::filesystem;
+
+class SysFsTest : public Test {
+ protected:
+  // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+  fs::path m_testDir;
+  String   m_testDirName;
+  // NOLINTEND(*-non-private-member-variables-in-classes)
+
+  fn SetUp() -> Unit override {
+    m_testDir     = fs::temp_directory_path() / "draconis_sysfs_test";
+    m_testDirName = m_testDir.string();
+
+    if (fs::exists(m_testDir))
+      fs::remove_all(m_testDir);
+
+    fs::create_directories(m_testDir);
+  }
+
+  fn TearDown() -> Unit override {
+    if (fs::exists(m_testDir))
+      fs::remove_all(m_testDir);
+  }
+
+  fn write(const fs::path& name, const StringView contents) const -> Unit {
+    fs::create_directories((m_testDir / name).parent_path());
+
+    std::ofstream ofs(m_testDir / name, std::ios::binary);
+    ofs.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+  }
+
+  /**
+   * @brief Every line forEachLine() reports for @p name, in order.
+   */
+  fn lines(const Directory& directory, const PCStr name) const -> Vec<String> {
+    Vec<String> seen;
+
+    const Result<> result = directory.forEachLine(name, [&seen](const StringView line) {
+      seen.emplace_back(line);
+      return false;
+    });
+
+    EXPECT_TRUE(result.has_value());
+    return seen;
+  }
+};
+
+TEST(SysFsParseTest, TrimEndStripsTrailingWhitespaceOnly) {
+  EXPECT_EQ(TrimEnd("Charging\n"), "Charging");
+  EXPECT_EQ(TrimEnd("  padded \t\r\n"), "  padded");
+  EXPECT_EQ(TrimEnd(" \n\t"), "");
+  EXPECT_EQ(TrimEnd(""), "");
+}
+
+TEST(SysFsParseTest, ParseIntRequiresTheWholeText) {
+  EXPECT_EQ(ParseInt<i32>("42"), 42);
+  EXPECT_EQ(ParseInt<i32>("-7"), -7);
+  EXPECT_EQ(ParseInt<u32>("ff", 16), 0xffU);
+
+  EXPECT_FALSE(ParseInt<i32>("").has_value());
+  EXPECT_FALSE(ParseInt<i32>("42\n").has_value());
+  EXPECT_FALSE(ParseInt<i32>("4x2").has_value());
+  EXPECT_FALSE(ParseInt<u32>("-1").has_value());
+  EXPECT_FALSE(ParseInt<u32>("99999999999").has_value());
+}
+
+TEST_F(SysFsTest, ReadsLinesAndIntegers) {
+  write("status", "Discharging\nignored\n");
+  write("capacity", "87\n");
+  write("vendor", "0x10de\n");
+  write("empty", "\n");
+
+  const Directory directory(m_testDirName.c_str());
+  ASSERT_TRUE(directory);
+
+  FileBuffer buffer;
+
+  EXPECT_EQ(directory.readLine("status", buffer), "Discharging");
+  EXPECT_EQ(directory.readInt<i32>("capacity"), 87);
+
+  // Hex attributes like PCI IDs carry a 0x prefix, which from_chars doesn't accept on its own.
+  EXPECT_EQ(directory.readInt<u32>("vendor", 16), 0x10deU);
+  EXPECT_FALSE(directory.readInt<u32>("vendor").has_value());
+
+  const Result<StringView> empty = directory.readLine("empty", buffer);
+  ASSERT_FALSE(empty.has_value());
+  EXPECT_EQ(empty.error().code, DracErrorCode::ParseError);
+
+  const Result<StringView> missing = directory.readLine("missing", buffer);
+  ASSERT_FALSE(missing.has_value());
+  EXPECT_EQ(missing.error().code, DracErrorCode::NotFound);
+}
+
+TEST_F(SysFsTest, MissingDirectoryFailsEveryRead) {
+  const Directory directory("/nonexistent/draconis_sysfs_test");
+  EXPECT_FALSE(directory);
+
+  FileBuffer buffer;
+
+  const Result<StringView> line = directory.readLine("anything", buffer);
+  ASSERT_FALSE(line.has_value());
+  EXPECT_EQ(line.error().code, DracErrorCode::NotFound);
+
+  EXPECT_FALSE(directory.open("sub").has_value());
+  EXPECT_FALSE(directory.forEachEntry([](StringView) { return false; }).has_value());
+}
+
+TEST_F(SysFsTest, OpensSubdirectories) {
+  write("BAT0/capacity", "50\n");
+
+  const Directory directory(m_testDirName.c_str());
+
+  const Result<Directory> battery = directory.open("BAT0");
+  ASSERT_TRUE(battery.has_value());
+  EXPECT_EQ(battery->readInt<i32>("capacity"), 50);
+
+  EXPECT_EQ(directory.open("BAT1").error().code, DracErrorCode::NotFound);
+}
+
+TEST_F(SysFsTest, LastLineNeedsNoNewline) {
+  write("lines", "first\n\nthird");
+
+  const Directory directory(m_testDirName.c_str());
+
+  EXPECT_EQ(lines(directory, "lines"), (Vec<String> { "first", "", "third" }));
+}
+
+TEST_F(SysFsTest, LinesSpanningChunksArriveWhole) {
+  // Enough numbered lines that several straddle each FILE_BUFFER_SIZE boundary.
+  String      contents;
+  Vec<String> expected;
+
+  for (usize i = 0; contents.size() < FILE_BUFFER_SIZE * 3; ++i) {
+    expected.push_back(std::format("line {} {}", i, String(i % 50, 'x')));
+    contents += expected.back() + '\n';
+  }
+
+  write("lines", contents);
+
+  const Directory directory(m_testDirName.c_str());
+
+  EXPECT_EQ(lines(directory, "lines"), expected);
+}
+
+TEST_F(SysFsTest, OverlongLinesArriveInPieces) {
+  const String longLine(FILE_BUFFER_SIZE + 100, 'a');
+
+  write("lines", "short\n" + longLine + "\nafter\n");
+
+  const Directory   directory(m_testDirName.c_str());
+  const Vec<String> seen = lines(directory, "lines");
+
+  // However the long line is split, its pieces add back up to it, and the lines around it are intact.
+  ASSERT_GE(seen.size(), 4U);
+  EXPECT_EQ(seen.front(), "short");
+  EXPECT_EQ(seen.back(), "after");
+
+  String joined;
+
+  for (usize i = 1; i + 1 < seen.size(); ++i) {
+    EXPECT_LE(seen[i].size(), FILE_BUFFER_SIZE);
+    joined += seen[i];
+  }
+
+  EXPECT_EQ(joined, longLine);
+}
+
+TEST_F(SysFsTest, ForEachLineStopsWhenVisitReturnsTrue) {
+  write("lines", "a\nb\nc\n");
+
+  const Directory directory(m_testDirName.c_str());
+  Vec<String>     seen;
+
+  ASSERT_TRUE(directory.forEachLine("lines", [&seen](const StringView line) {
+    seen.emplace_back(line);
+    return line == "b";
+  }));
+
+  EXPECT_EQ(seen, (Vec<String> { "a", "b" }));
+}
+
+TEST_F(SysFsTest, ListsEveryEntry) {
+  // More entries than fit in one getdents64 buffer.
+  Vec<String> expected;
+
+  for (usize i = 0; i < 300; ++i) {
+    expected.push_back(std::format("entry_with_a_fairly_long_name_{:03}", i));
+    write(expected.back(), "");
+  }
+
+  fs::create_directories(m_testDir / "subdirectory");
+  expected.emplace_back("subdirectory");
+
+  const Directory directory(m_testDirName.c_str());
+  Vec<String>     seen;
+
+  const Result<bool> stopped = directory.forEachEntry([&seen](const StringView name) {
+    seen.emplace_back(name);
+    return false;
+  });
+
+  ASSERT_TRUE(stopped.has_value());
+  EXPECT_FALSE(*stopped);
+
+  std::ranges::sort(seen);
+  std::ranges::sort(expected);
+  EXPECT_EQ(seen, expected);
+}
+
+TEST_F(SysFsTest, ForEachEntryStopsWhenVisitReturnsTrue) {
+  write("a", "");
+  write("b", "");
+
+  const Directory directory(m_testDirName.c_str());
+  usize           visited = 0;
+
+  const Result<bool> stopped = directory.forEachEntry([&visited](StringView) { return ++visited == 1; });
+
+  ASSERT_TRUE(stopped.has_value());
+  EXPECT_TRUE(*stopped);
+  EXPECT_EQ(visited, 1U);
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,175 @@
+#include <coroutine>
+#include <future>
+#include <stdexcept>
+
+#include <Drac++/Utils/Error.hpp>
+#include <Drac++/Utils/Task.hpp>
+#include <Drac++/Utils/Types.hpp>
+
+#include "gtest/gtest.h"
+
+using namespace testing;
+using namespace draconis::utils;
+using namespace draconis::utils::threading;
+
+using cancellation::CancellationScope;
+using error::DracErrorCode;
+
+using types::i32;
+using types::Result;
+using types::String;
+using types::Unit;
+
+namespace {
+  // Minimal eagerly-started coroutine, just enough to co_await a Task from a test.
+  struct Detached {
+    struct promise_type {
+      fn get_return_object() -> Detached {
+        return {};
+      }
+
+      fn initial_suspend() -> std::suspend_never {
+        return {};
+      }
+
+      fn final_suspend() noexcept -> std::suspend_never {
+        return {};
+      }
+
+      fn return_void() -> Unit {}
+
+      fn unhandled_exception() -> Unit {
+        std::terminate();
+      }
+    };
+  };
+
+  fn AwaitInto(Task<i32> task, std::promise<Result<i32>>& out) -> Detached {
+    out.set_value(co_await task);
+  }
+
+  fn AwaitScopeInto(Task<i32> task, std::promise<bool>& inScope) -> Detached {
+    (void)co_await task;
+    inScope.set_value(CancellationScope::current() != nullptr);
+  }
+} // namespace
+
+TEST(TaskTest, GetReturnsTheJobResult) {
+  Task<String> task = Spawn([]() -> Result<String> { return "done"; });
+
+  Result<String> result = task.get();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(*result, "done");
+  EXPECT_TRUE(task.ready());
+}
+
+TEST(TaskTest, ExceptionsBecomeInternalErrors) {
+  Task<i32> task = Spawn([]() -> Result<i32> { throw std::runtime_error("boom"); });
+
+  Result<i32> result = task.get();
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code, DracErrorCode::InternalError);
+}
+
+TEST(TaskTest, NonStandardExceptionsBecomeInternalErrors) {
+  Task<i32> task = Spawn([]() -> Result<i32> { throw 42; });
+
+  Result<i32> result = task.get();
+
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code, DracErrorCode::InternalError);
+}
+
+TEST(TaskTest, CancelAfterCompletionDoesNothing) {
+  Task<i32> task = Spawn([]() -> Result<i32> { return 1; });
+
+  ASSERT_TRUE(task.waitFor(std::chrono::seconds(5)));
+
+  task.cancel();
+
+  EXPECT_FALSE(task.stopToken().stop_requested());
+  EXPECT_EQ(task.get(), 1);
+}
+
+TEST(TaskTest, CancelCompletesImmediatelyAndSignalsTheJob) {
+  std::promise<Unit> release;
+  std::promise<bool> sawStop;
+
+  Task<i32> task = Spawn([gate = release.get_future().share(), &sawStop](const std::stop_token& token) -> Result<i32> {
+    gate.wait();
+    sawStop.set_value(token.stop_requested());
+    return 1;
+  });
+
+  task.cancel();
+
+  ASSERT_TRUE(task.ready());
+
+  Result<i32> result = task.get();
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().code, DracErrorCode::Cancelled);
+
+  release.set_value();
+
+  // Either the job saw the stop request, or it was skipped before it started.
+  std::future<bool> stopped = sawStop.get_future();
+  if (stopped.wait_for(std::chrono::seconds(1)) == std::future_status::ready)
+    EXPECT_TRUE(stopped.get());
+}
+
+TEST(TaskTest, CoAwaitResumesWithTheResult) {
+  std::promise<Unit> release;
+
+  Task<i32> task = Spawn([gate = release.get_future().share()]() -> Result<i32> {
+    gate.wait();
+    return 42;
+  });
+
+  std::promise<Result<i32>> awaited;
+  AwaitInto(task, awaited);
+
+  release.set_value();
+
+  Result<i32> result = awaited.get_future().get();
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(*result, 42);
+}
+
+TEST(TaskTest, AwaiterResumesOutsideTheJobsScope) {
+  std::promise<Unit> release;
+
+  Task<i32> task = Spawn([gate = release.get_future().share()]() -> Result<i32> {
+    gate.wait();
+    return 42;
+  });
+
+  std::promise<bool> inScope;
+  AwaitScopeInto(task, inScope);
+
+  release.set_value();
+
+  EXPECT_FALSE(inScope.get_future().get());
+}
+
+TEST(TaskTest, SubmittedWorkIsNotPendingOnceItsFutureIsReady) {
+  ThreadPool& pool = ThreadPool::shared();
+
+  for (i32 i = 0; i < 200; ++i) {
+    EXPECT_EQ(pool.submit([i] { return i; }).get(), i);
+    EXPECT_EQ(pool.pending(), 0u);
+  }
+}
+
+TEST(TaskTest, SubmitPropagatesExceptionsThroughTheFuture) {
+  auto future = ThreadPool::shared().submit([] -> i32 { throw std::runtime_error("boom"); });
+
+  EXPECT_THROW((void)future.get(), std::runtime_error);
+}
+
+fn main(i32 argc, char** argv) -> i32 {
+  InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,13 +1,20 @@
 #pragma once
 
+#include <algorithm> // std::{max, min}
 #include <curl/curl.h>
 #include <utility> // std::{exchange, move}
 
+#include <Drac++/Utils/Cancellation.hpp>
 #include <Drac++/Utils/Error.hpp>
 #include <Drac++/Utils/Types.hpp>
 
 namespace Curl {
   namespace {
+    using draconis::utils::cancellation::CancellationScope;
+    using draconis::utils::cancellation::CheckCancelled;
+    using draconis::utils::cancellation::RemainingTime;
+    using draconis::utils::cancellation::StopRequested;
+
     using draconis::utils::error::DracError;
     using enum draconis::utils::error::DracErrorCode;
 
@@ -40,6 +47,7 @@ namespace Curl {
   class Easy {
     CURL*             m_curl      = nullptr;
     Option<DracError> m_initError = None; ///< Stores any error that occurred during initialization via options constructor
+    Option<i64>       m_timeoutMs = None; ///< Timeout set through setTimeout(), so perform() can tighten it to the caller's deadline
 
     static fn writeCallback(RawPointer contents, const usize size, const usize nmemb, String* str) -> usize {
       const usize totalSize = size * nmemb;
@@ -47,6 +55,11 @@ namespace Curl {
       return totalSize;
     }
 
+    // Called by curl_easy_perform on the calling thread, so it sees that thread's cancellation scope.
+    static fn progressCallback(RawPointer /*clientp*/, curl_off_t /*dltotal*/, curl_off_t /*dlnow*/, curl_off_t /*ultotal*/, curl_off_t /*ulnow*/) -> i32 {
+      return StopRequested() ? 1 : 0;
+    }
+
    public:
     /**
      * @brief Default constructor. Initializes a CURL easy handle.
@@ -116,7 +129,7 @@ namespace Curl {
      * @param other The other Easy object to move from.
      */
     Easy(Easy&& other) noexcept
-      : m_curl(std::exchange(other.m_curl, nullptr)), m_initError(std::move(other.m_initError)) {}
+      : m_curl(std::exchange(other.m_curl, nullptr)), m_initError(std::move(other.m_initError)), m_timeoutMs(other.m_timeoutMs) {}
 
     /**
      * @brief Move assignment operator.
@@ -130,6 +143,7 @@ namespace Curl {
 
         m_curl      = std::exchange(other.m_curl, nullptr);
         m_initError = std::move(other.m_initError);
+        m_timeoutMs = other.m_timeoutMs;
       }
 
       return *this;
@@ -183,6 +197,10 @@ namespace Curl {
     /**
      * @brief Performs a blocking file transfer.
      * @return A Result indicating success or failure.
+     *
+     * @details Inside a CancellationScope, the transfer is cut short at the
+     * scope's deadline and aborted (within about a second) once its stop
+     * token is signalled, returning a Timeout or Cancelled error.
      */
     fn perform() -> Result<> {
       if (!m_curl)
@@ -191,8 +209,32 @@ namespace Curl {
       if (m_initError)
         ERR_FMT(InternalError, "Cannot perform request, CURL handle initialization failed: {}", m_initError->message);
 
-      if (const CURLcode res = curl_easy_perform(m_curl); res != CURLE_OK)
+      if (CancellationScope::current()) {
+        if (Result res = CheckCancelled(); !res)
+          return res;
+
+        if (const Option<std::chrono::milliseconds> remaining = RemainingTime()) {
+          // A timeout of 0 means "none" to curl, so never go below 1ms.
+          const i64 limit = std::max<i64>(m_timeoutMs ? std::min(*m_timeoutMs, remaining->count()) : remaining->count(), 1);
+
+          if (Result res = setOpt(CURLOPT_TIMEOUT_MS, limit); !res)
+            return res;
+        }
+
+        if (Result res = setOpt(CURLOPT_XFERINFOFUNCTION, progressCallback); !res)
+          return res;
+
+        if (Result res = setOpt(CURLOPT_NOPROGRESS, 0L); !res)
+          return res;
+      }
+
+      if (const CURLcode res = curl_easy_perform(m_curl); res != CURLE_OK) {
+        if (res == CURLE_ABORTED_BY_CALLBACK || res == CURLE_OPERATION_TIMEDOUT)
+          if (Result cancelled = CheckCancelled(); !cancelled)
+            return cancelled;
+
         ERR_FMT(ApiUnavailable, "curl_easy_perform failed: {}", curl_easy_strerror(res));
+      }
 
       return {};
     }
@@ -266,7 +308,11 @@ namespace Curl {
      * @return A Result indicating success or failure.
      */
     fn setTimeout(const i64 timeout) -> Result<> {
-      return setOpt(CURLOPT_TIMEOUT, timeout);
+      if (Result res = setOpt(CURLOPT_TIMEOUT, timeout); !res)
+        return res;
+
+      m_timeoutMs = timeout * 1000;
+      return {};
     }
 
     /**
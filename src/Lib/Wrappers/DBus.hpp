@@ -2,18 +2,26 @@
 
 #if (defined(__linux__) || defined(__FreeBSD__) || defined(__DragonFly__) || defined(__NetBSD__)) && DRAC_ENABLE_NOWPLAYING
 
+  #include <algorithm>   // std::min
+  #include <chrono>      // std::chrono::milliseconds
   #include <cstring>
   #include <dbus/dbus.h> // DBus Library
+  #include <limits>      // std::numeric_limits
   #include <type_traits> // std::is_convertible_v
   #include <utility>     // std::exchange, std::forward
 
+  #include <Drac++/Utils/Cancellation.hpp>
   #include <Drac++/Utils/Error.hpp>
   #include <Drac++/Utils/Types.hpp>
 
 namespace DBus {
   namespace {
+    using draconis::utils::cancellation::CheckCancelled;
+    using draconis::utils::cancellation::RemainingTime;
+
     using enum draconis::utils::error::DracErrorCode;
 
+    using draconis::utils::types::Err;
     using draconis::utils::types::i32;
     using draconis::utils::types::None;
     using draconis::utils::types::Option;
@@ -458,15 +466,31 @@ namespace DBus {
      * @param message The D-Bus message guard to send.
      * @param timeout_milliseconds Timeout duration in milliseconds.
      * @return Result containing the reply MessageGuard on success, or DracError on failure.
+     *
+     * @details Inside a CancellationScope, nothing is sent once the scope is
+     * cancelled, and the wait is shortened so it ends by the scope's deadline.
      */
     [[nodiscard]] fn sendWithReplyAndBlock(const Message& message, const i32 timeout_milliseconds = 1000) const
       -> Result<Message> {
       if (!m_conn || !message.get())
         ERR(InvalidArgument, "Invalid connection or message provided to sendWithReplyAndBlock");
 
+      if (Result live = CheckCancelled(); !live)
+        return Err(live.error());
+
+      i32 timeout = timeout_milliseconds;
+
+      // Negative timeouts mean "libdbus default", which is far longer than any deadline we'd be given.
+      if (const Option<std::chrono::milliseconds> remaining = RemainingTime())
+        if (timeout < 0 || remaining->count() < timeout)
+          timeout = static_cast<i32>(std::min<std::chrono::milliseconds::rep>(remaining->count(), std::numeric_limits<i32>::max()));
+
+      if (timeout == 0)
+        ERR(Timeout, "Readout deadline passed before the D-Bus call could be made");
+
       Error        err;
       DBusMessage* rawReply =
-        dbus_connection_send_with_reply_and_block(m_conn, message.get(), timeout_milliseconds, err.get());
+        dbus_connection_send_with_reply_and_block(m_conn, message.get(), timeout, err.get());
 
       if (err.isSet()) {
         if (const char* errName = err.name()) {